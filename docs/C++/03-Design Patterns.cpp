@@ -21,6 +21,8 @@
 #include <string>
 #include <map>
 #include <queue>
+#include <deque>
+#include <list>
 #include <stack>
 #include <algorithm>
 #include <functional>
@@ -29,7 +31,31 @@
 #include <condition_variable>
 #include <unordered_map>
 #include <sstream>
+#include <iomanip>
 #include <chrono>
+#include <future>
+#include <optional>
+#include <array>
+#include <limits>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 // ================================================================================
 // CREATIONAL PATTERNS
@@ -44,59 +70,681 @@
  * Use Case: Logger, Database connection, Configuration manager
  */
 
-class Logger {
+// What happens when a thread's ring buffer is full in async mode
+enum class LogOverflowPolicy {
+    Drop,   // Discard the record and count it; the caller never waits
+    Block   // Wait for the background thread to make room (backpressure)
+};
+
+// Destination for formatted log batches; called only from the background thread
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+    virtual void write(std::string_view batch) = 0;
+    virtual void flush() {}
+};
+
+class FileLogSink : public LogSink {
+private:
+    std::FILE* file;
+
+public:
+    explicit FileLogSink(const std::string& path) : file(std::fopen(path.c_str(), "a")) {
+        if (!file) {
+            throw std::runtime_error("Failed to open log file: " + path);
+        }
+    }
+
+    ~FileLogSink() override { std::fclose(file); }
+
+    FileLogSink(const FileLogSink&) = delete;
+    FileLogSink& operator=(const FileLogSink&) = delete;
+
+    void write(std::string_view batch) override {
+        std::fwrite(batch.data(), 1, batch.size(), file);
+    }
+
+    void flush() override { std::fflush(file); }
+};
+
+class StreamLogSink : public LogSink {
 private:
-    static std::unique_ptr<Logger> instance;
-    static std::mutex mutex_;
+    std::ostream& out;
+
+public:
+    explicit StreamLogSink(std::ostream& out) : out(out) {}
+
+    void write(std::string_view batch) override { out.write(batch.data(), batch.size()); }
+    void flush() override { out.flush(); }
+};
+
+struct AsyncLogConfig {
+    std::shared_ptr<LogSink> sink;                        // Required
+    size_t ring_capacity = 4096;                          // Records per thread, rounded up to a power of two
+    size_t batch_size = 512;                              // Records formatted per sink write
+    std::chrono::milliseconds flush_interval{20};         // Background thread wakeup period
+    LogOverflowPolicy overflow = LogOverflowPolicy::Drop;
+};
+
+struct AsyncLogStats {
+    uint64_t written = 0;    // Records handed to the sink
+    uint64_t dropped = 0;    // Records lost to a full ring (Drop policy) or a stopped logger
+    uint64_t batches = 0;    // Sink writes
+    size_t threads = 0;      // Per-thread rings allocated so far
+    size_t ring_bytes = 0;   // Memory held by all rings
+};
+
+/**
+ * Fixed-size log record. The format string is kept as a pointer (it must be a
+ * string literal) and the arguments are packed raw into the payload as
+ * [tag][value] pairs; nothing is converted to text until the background thread
+ * formats the record. String arguments are copied and truncated to fit (async
+ * mode only; synchronous logging formats directly).
+ */
+struct alignas(64) LogRecord {
+    enum ArgTag : uint8_t { Int, UInt, Double, Bool, Char, String };
+
+    int64_t timestamp = 0;           // system_clock ticks
+    const char* format = nullptr;
+    uint32_t thread_index = 0;
+    uint16_t payload_size = 0;
+    char payload[256 - 24];
+
+    void put(ArgTag tag, const void* value, size_t bytes) {
+        if (size_t(payload_size) + 1 + bytes > sizeof(payload)) {
+            return;  // No room: the formatter prints the placeholder as-is
+        }
+        payload[payload_size++] = static_cast<char>(tag);
+        std::memcpy(payload + payload_size, value, bytes);
+        payload_size += static_cast<uint16_t>(bytes);
+    }
+
+    void putString(std::string_view s) {
+        if (size_t(payload_size) + 2 > sizeof(payload)) {
+            return;
+        }
+        size_t len = std::min({s.size(), size_t(255), sizeof(payload) - payload_size - 2});
+        payload[payload_size++] = static_cast<char>(String);
+        payload[payload_size++] = static_cast<char>(static_cast<uint8_t>(len));
+        std::memcpy(payload + payload_size, s.data(), len);
+        payload_size += static_cast<uint16_t>(len);
+    }
+
+    template<typename T>
+    void pack(const T& value) {
+        using U = std::decay_t<T>;
+        if constexpr (std::is_same_v<U, bool>) {
+            put(Bool, &value, 1);
+        } else if constexpr (std::is_same_v<U, char>) {
+            put(Char, &value, 1);
+        } else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>) {
+            int64_t v = value;
+            put(Int, &v, sizeof(v));
+        } else if constexpr (std::is_integral_v<U>) {
+            uint64_t v = value;
+            put(UInt, &v, sizeof(v));
+        } else if constexpr (std::is_floating_point_v<U>) {
+            double v = value;
+            put(Double, &v, sizeof(v));
+        } else {
+            static_assert(std::is_convertible_v<const T&, std::string_view>,
+                          "log arguments must be arithmetic or string-like");
+            putString(std::string_view(value));
+        }
+    }
+
+    // Substitute each "{}" in format with the next packed argument
+    void formatMessage(std::string& out) const {
+        size_t pos = 0;
+        const char* p = format;
+        while (true) {
+            const char* placeholder = std::strstr(p, "{}");
+            if (!placeholder || pos >= payload_size) {
+                out += p;
+                return;
+            }
+            out.append(p, placeholder);
+            p = placeholder + 2;
+            char buf[32];
+            auto tag = static_cast<ArgTag>(payload[pos++]);
+            switch (tag) {
+                case Int: case UInt: case Double: {
+                    char raw[8];
+                    std::memcpy(raw, payload + pos, 8);
+                    pos += 8;
+                    std::to_chars_result res;
+                    if (tag == Int) {
+                        int64_t v; std::memcpy(&v, raw, 8);
+                        res = std::to_chars(buf, buf + sizeof(buf), v);
+                    } else if (tag == UInt) {
+                        uint64_t v; std::memcpy(&v, raw, 8);
+                        res = std::to_chars(buf, buf + sizeof(buf), v);
+                    } else {
+                        double v; std::memcpy(&v, raw, 8);
+                        res = std::to_chars(buf, buf + sizeof(buf), v);
+                    }
+                    out.append(buf, res.ptr);
+                    break;
+                }
+                case Bool:
+                    out += payload[pos++] ? "true" : "false";
+                    break;
+                case Char:
+                    out += payload[pos++];
+                    break;
+                case String: {
+                    size_t len = static_cast<uint8_t>(payload[pos++]);
+                    out.append(payload + pos, len);
+                    pos += len;
+                    break;
+                }
+            }
+        }
+    }
+};
+
+/**
+ * Single-producer/single-consumer ring owned by one logging thread and drained
+ * by the background thread. When a thread exits its ring is released and the
+ * next new thread reuses it, so memory is bounded by the peak thread count.
+ */
+struct LogRing {
+    std::vector<LogRecord> records;
+    size_t mask;
+    uint32_t index;
+    std::atomic<bool> in_use{true};
+    std::atomic<uint64_t> dropped{0};         // Written only by the owning thread
+
+    alignas(64) std::atomic<size_t> head{0};  // Next slot to write (producer)
+    size_t cached_tail = 0;                   // Producer's last view of tail
+    alignas(64) std::atomic<size_t> tail{0};  // Next slot to read (consumer)
+
+    LogRing(size_t capacity, uint32_t index) : records(capacity), mask(capacity - 1), index(index) {}
+
+    LogRecord* tryReserve() {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cached_tail == records.size()) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (h - cached_tail == records.size()) {
+                return nullptr;
+            }
+        }
+        return &records[h & mask];
+    }
 
+    void commit() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // True once the ring is at least half full; refreshes the cached tail only past that point
+    bool aboveHighWater() {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - cached_tail < records.size() / 2) {
+            return false;
+        }
+        cached_tail = tail.load(std::memory_order_acquire);
+        return h - cached_tail >= records.size() / 2;
+    }
+
+    // Copy up to max records into out; returns how many were taken
+    size_t drain(std::vector<LogRecord>& out, size_t max) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t n = std::min(head.load(std::memory_order_acquire) - t, max);
+        for (size_t i = 0; i < n; ++i) {
+            out.push_back(records[(t + i) & mask]);
+        }
+        tail.store(t + n, std::memory_order_release);
+        return n;
+    }
+};
+
+class Logger {
+private:
+    // Synchronous mode
     std::vector<std::string> logs;
     std::mutex log_mutex;
 
+    // Asynchronous mode
+    AsyncLogConfig config;
+    std::atomic<bool> async_enabled{false};
+    std::atomic<bool> wake_requested{false};
+    std::thread worker;
+
+    std::mutex rings_mutex;
+    std::vector<std::unique_ptr<LogRing>> rings;
+    size_t ring_capacity = 0;                 // Fixed by the first startAsync() call
+
+    std::mutex worker_mutex;
+    std::condition_variable worker_cv;
+    std::condition_variable flushed_cv;
+    bool running = false;
+    uint64_t flush_requested = 0;
+    uint64_t flush_completed = 0;
+    uint64_t written = 0;
+    uint64_t batches = 0;
+
     Logger() = default;  // Private constructor
-    ~Logger() = default;
+    ~Logger() { stopAsync(); }
+
+    struct ThreadSlot {
+        LogRing* ring = nullptr;
+        ~ThreadSlot() {
+            if (ring) {
+                ring->in_use.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    LogRing* threadRing() {
+        static thread_local ThreadSlot slot;
+        if (slot.ring) {
+            return slot.ring;
+        }
+        std::lock_guard<std::mutex> lock(rings_mutex);
+        for (auto& ring : rings) {
+            bool idle = false;
+            if (ring->in_use.compare_exchange_strong(idle, true, std::memory_order_acquire)) {
+                return slot.ring = ring.get();
+            }
+        }
+        rings.push_back(std::make_unique<LogRing>(ring_capacity, static_cast<uint32_t>(rings.size())));
+        return slot.ring = rings.back().get();
+    }
+
+    void wakeWorker() {
+        wake_requested.store(true, std::memory_order_relaxed);
+        worker_cv.notify_one();
+    }
+
+    template<typename T>
+    static void appendArg(std::string& out, const T& value) {
+        using U = std::decay_t<T>;
+        if constexpr (std::is_same_v<U, bool>) {
+            out += value ? "true" : "false";
+        } else if constexpr (std::is_same_v<U, char>) {
+            out += value;
+        } else if constexpr (std::is_arithmetic_v<U>) {
+            char buf[32];
+            out.append(buf, std::to_chars(buf, buf + sizeof(buf), value).ptr);
+        } else {
+            static_assert(std::is_convertible_v<const T&, std::string_view>,
+                          "log arguments must be arithmetic or string-like");
+            out += std::string_view(value);
+        }
+    }
+
+    // Same "{}" substitution as LogRecord::formatMessage, straight from the arguments
+    template<typename... Args>
+    static void formatDirect(std::string& out, const char* fmt, const Args&... args) {
+        const char* p = fmt;
+        [[maybe_unused]] auto substitute = [&](const auto& arg) {
+            const char* placeholder = std::strstr(p, "{}");
+            if (placeholder) {
+                out.append(p, placeholder);
+                appendArg(out, arg);
+                p = placeholder + 2;
+            }
+        };
+        (substitute(args), ...);
+        out += p;
+    }
+
+    // Synchronous mode formats in the caller, so strings are never truncated
+    template<typename... Args>
+    void logSync(const char* fmt, const Args&... args) {
+        static thread_local TimestampFormatter clock;
+        std::string line = "[";
+        clock.append(line, std::chrono::system_clock::now().time_since_epoch().count());
+        line += "] ";
+        formatDirect(line, fmt, args...);
+        std::lock_guard<std::mutex> lock(log_mutex);
+        logs.push_back(std::move(line));
+    }
+
+    template<size_t N, typename... Args>
+    void encode(LogRecord& record, const char (&fmt)[N], const Args&... args) {
+        record.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
+        record.format = fmt;
+        record.payload_size = 0;
+        (record.pack(args), ...);
+    }
+
+    // Formats "YYYY-MM-DD HH:MM:SS.uuuuuu", calling localtime only when the second changes
+    struct TimestampFormatter {
+        std::time_t cached_second = -1;
+        char date[32];
+        size_t date_len = 0;
+
+        void append(std::string& out, int64_t ticks) {
+            using namespace std::chrono;
+            auto since_epoch = system_clock::duration(ticks);
+            std::time_t seconds = system_clock::to_time_t(system_clock::time_point(since_epoch));
+            if (seconds != cached_second) {
+                std::tm tm{};
+#ifdef _WIN32
+                localtime_s(&tm, &seconds);
+#else
+                localtime_r(&seconds, &tm);
+#endif
+                date_len = std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &tm);
+                cached_second = seconds;
+            }
+            out.append(date, date_len);
+            auto micros = duration_cast<microseconds>(since_epoch).count() % 1000000;
+            char buf[7] = {'.', '0', '0', '0', '0', '0', '0'};
+            for (int i = 6; i > 0 && micros > 0; --i, micros /= 10) {
+                buf[i] = static_cast<char>('0' + micros % 10);
+            }
+            out.append(buf, sizeof(buf));
+        }
+    };
+
+    static void formatRecord(std::string& out, const LogRecord& record, TimestampFormatter& clock,
+                             bool with_thread) {
+        out += '[';
+        clock.append(out, record.timestamp);
+        out += "] ";
+        if (with_thread) {
+            char buf[16];
+            out += "[T";
+            out.append(buf, std::to_chars(buf, buf + sizeof(buf), record.thread_index).ptr);
+            out += "] ";
+        }
+        record.formatMessage(out);
+    }
+
+    // Drain rings into batches, merge each batch by timestamp, and hand it to the sink
+    void workerLoop() {
+        std::vector<LogRecord> batch;
+        batch.reserve(config.batch_size);
+        std::vector<LogRing*> snapshot;
+        std::string text;
+        TimestampFormatter clock;
+
+        std::unique_lock<std::mutex> lock(worker_mutex);
+        while (true) {
+            bool stopping = !running;
+            uint64_t flush_ticket = flush_requested;
+            lock.unlock();
+
+            {
+                std::lock_guard<std::mutex> rings_lock(rings_mutex);
+                snapshot.clear();
+                for (auto& ring : rings) {
+                    snapshot.push_back(ring.get());
+                }
+            }
+
+            size_t drained = 0;
+            while (true) {
+                batch.clear();
+                for (LogRing* ring : snapshot) {
+                    ring->drain(batch, config.batch_size - batch.size());
+                }
+                if (batch.empty()) {
+                    break;
+                }
+                std::stable_sort(batch.begin(), batch.end(),
+                                 [](const LogRecord& a, const LogRecord& b) { return a.timestamp < b.timestamp; });
+                text.clear();
+                for (const auto& record : batch) {
+                    formatRecord(text, record, clock, true);
+                    text += '\n';
+                }
+                config.sink->write(text);
+                drained += batch.size();
+                ++batches;
+            }
+            if (drained > 0 || flush_ticket > flush_completed) {
+                config.sink->flush();
+            }
+
+            lock.lock();
+            written += drained;
+            if (flush_ticket > flush_completed) {
+                flush_completed = flush_ticket;
+                flushed_cv.notify_all();
+            }
+            if (stopping) {
+                break;
+            }
+            worker_cv.wait_for(lock, config.flush_interval, [this] {
+                return !running || flush_requested > flush_completed ||
+                       wake_requested.exchange(false, std::memory_order_relaxed);
+            });
+        }
+    }
 
 public:
     // Delete copy constructor and assignment operator
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
 
+    // Function-local static: initialization is thread-safe (C++11) and every later
+    // call is a plain load with no lock, so it is cheap enough for hot paths
     static Logger& getInstance() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        if (!instance) {
-            instance = std::unique_ptr<Logger>(new Logger());
+        static Logger instance;
+        return instance;
+    }
+
+    /**
+     * Switch to asynchronous mode. Each logging thread gets its own ring of
+     * fixed-size records and a background thread formats and writes them to
+     * config.sink in batches. Memory is bounded by
+     * ring_capacity * sizeof(LogRecord) per concurrently logging thread.
+     * ring_capacity is fixed by the first call; restarting reuses the rings.
+     */
+    void startAsync(AsyncLogConfig cfg) {
+        if (!cfg.sink) {
+            throw std::invalid_argument("AsyncLogConfig::sink must be set");
+        }
+        if (cfg.ring_capacity == 0 || cfg.batch_size == 0) {
+            throw std::invalid_argument("ring_capacity and batch_size must be positive");
+        }
+        stopAsync();
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            if (ring_capacity == 0) {
+                ring_capacity = 1;
+                while (ring_capacity < cfg.ring_capacity) {
+                    ring_capacity <<= 1;
+                }
+            }
         }
-        return *instance;
+        config = std::move(cfg);
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex);
+            running = true;
+        }
+        worker = std::thread(&Logger::workerLoop, this);
+        async_enabled.store(true, std::memory_order_release);
     }
 
-    void log(const std::string& message) {
-        std::lock_guard<std::mutex> lock(log_mutex);
-        auto now = std::chrono::system_clock::now();
-        auto time_t = std::chrono::system_clock::to_time_t(now);
+    // Drain everything still queued, then stop the background thread. Callers
+    // should stop logging first; records written concurrently may be left queued.
+    void stopAsync() {
+        if (!worker.joinable()) {
+            return;
+        }
+        async_enabled.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(worker_mutex);
+            running = false;
+        }
+        worker_cv.notify_one();
+        worker.join();
+    }
+
+    bool isAsync() const {
+        return async_enabled.load(std::memory_order_acquire);
+    }
+
+    // Block until every record logged before this call has reached the sink
+    void flush() {
+        if (!isAsync()) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(worker_mutex);
+        uint64_t ticket = ++flush_requested;
+        worker_cv.notify_one();
+        flushed_cv.wait(lock, [&] { return flush_completed >= ticket || !running; });
+    }
+
+    /**
+     * Log a message with "{}" placeholders, e.g. log("user {} took {} ms", id, ms).
+     * The format must be a string literal: async mode stores only the pointer.
+     * In async mode this costs a clock read and a few memcpys into the calling
+     * thread's ring; returns false if the record was dropped. A ring past half
+     * full wakes the background thread early, so Drop only loses records when
+     * the consumer really cannot keep up.
+     */
+    template<size_t N, typename... Args>
+    bool log(const char (&fmt)[N], const Args&... args) {
+        if (!isAsync()) {
+            logSync(fmt, args...);
+            return true;
+        }
+
+        LogRing* ring = threadRing();
+        LogRecord* slot = ring->tryReserve();
+        if (!slot && config.overflow == LogOverflowPolicy::Block) {
+            while (!slot && isAsync()) {
+                wakeWorker();
+                std::this_thread::yield();
+                slot = ring->tryReserve();
+            }
+        }
+        if (!slot) {
+            ring->dropped.store(ring->dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        encode(*slot, fmt, args...);
+        slot->thread_index = ring->index;
+        ring->commit();
+        if (ring->aboveHighWater()) {
+            wakeWorker();
+        }
+        return true;
+    }
 
-        std::stringstream ss;
-        ss << std::put_time(std::localtime(&time_t), "%Y-%m-%d %H:%M:%S");
-        logs.push_back("[" + ss.str() + "] " + message);
+    // A mutable char array (e.g. an snprintf buffer) is not a literal and may not
+    // outlive the call, so it is formatted here and logged as a runtime string
+    template<size_t N, typename... Args>
+    bool log(char (&fmt)[N], const Args&... args) {
+        std::string message;
+        formatDirect(message, fmt, args...);
+        return log(message);
     }
 
-    void printLogs() const {
+    // In async mode runtime strings are copied into the record, truncated to the payload size
+    bool log(const std::string& message) {
+        if (isAsync()) {
+            return log("{}", std::string_view(message));
+        }
+        logSync("{}", std::string_view(message));
+        return true;
+    }
+
+    AsyncLogStats stats() {
+        AsyncLogStats s;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            for (const auto& ring : rings) {
+                s.dropped += ring->dropped.load(std::memory_order_relaxed);
+            }
+            s.threads = rings.size();
+            s.ring_bytes = rings.size() * ring_capacity * sizeof(LogRecord);
+        }
+        std::lock_guard<std::mutex> lock(worker_mutex);
+        s.written = written;
+        s.batches = batches;
+        return s;
+    }
+
+    void printLogs() {
+        std::lock_guard<std::mutex> lock(log_mutex);
         for (const auto& log : logs) {
             std::cout << log << std::endl;
         }
     }
+
+    void clearLogs() {
+        std::lock_guard<std::mutex> lock(log_mutex);
+        logs.clear();
+    }
+};
+
+// Sink that only counts bytes, for measuring the logger without I/O
+class NullLogSink : public LogSink {
+public:
+    std::atomic<size_t> bytes{0};
+    void write(std::string_view batch) override { bytes += batch.size(); }
 };
 
-// Initialize static members
-std::unique_ptr<Logger> Logger::instance = nullptr;
-std::mutex Logger::mutex_;
+void benchmark_async_logger() {
+    const int thread_count = 4;
+    const int per_thread = 50000;
+
+    auto run = [&](const char* name) {
+        auto start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; ++t) {
+            threads.emplace_back([t, per_thread] {
+                for (int i = 0; i < per_thread; ++i) {
+                    Logger::getInstance().log("worker {} processed item {} in {} ms", t, i, 0.25);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto logged = std::chrono::high_resolution_clock::now();
+        Logger::getInstance().flush();
+        auto end = std::chrono::high_resolution_clock::now();
+        double records = thread_count * per_thread;
+        std::cout << name << ": " << std::chrono::duration<double, std::nano>(logged - start).count() / records
+                  << " ns/record in callers, "
+                  << std::chrono::duration<double, std::nano>(end - start).count() / records
+                  << " ns/record until flushed" << std::endl;
+    };
+
+    run("Synchronous (mutex + vector)");
+    Logger::getInstance().clearLogs();
+
+    auto sink = std::make_shared<NullLogSink>();
+    AsyncLogConfig config;
+    config.sink = sink;
+    config.overflow = LogOverflowPolicy::Block;
+    Logger::getInstance().startAsync(config);
+    run("Asynchronous (per-thread ring, Block)");
+    Logger::getInstance().stopAsync();
+
+    AsyncLogStats s = Logger::getInstance().stats();
+    std::cout << "Written: " << s.written << ", dropped: " << s.dropped << ", batches: " << s.batches
+              << ", rings: " << s.threads << " (" << s.ring_bytes / 1024 << " KiB)" << std::endl;
+}
 
 void demonstrate_singleton() {
     std::cout << "=== SINGLETON PATTERN ===" << std::endl;
 
     Logger::getInstance().log("Application started");
     Logger::getInstance().log("User logged in");
-    Logger::getInstance().log("Processing data");
+    Logger::getInstance().log("Processing {} records", 3);
 
     Logger::getInstance().printLogs();
+    Logger::getInstance().clearLogs();
+
+    std::cout << "\nAsync mode (records formatted by a background thread):" << std::endl;
+    AsyncLogConfig config;
+    config.sink = std::make_shared<StreamLogSink>(std::cout);
+    Logger::getInstance().startAsync(config);
+    std::thread worker([] { Logger::getInstance().log("Worker {} says {}", 1, "hello"); });
+    worker.join();
+    Logger::getInstance().log("Cache hit ratio {} ({} of {})", 0.875, 7u, 8u);
+    Logger::getInstance().flush();
+    Logger::getInstance().stopAsync();
+
+    benchmark_async_logger();
     std::cout << std::endl;
 }
 
@@ -908,34 +1556,83 @@ private:
     std::string texture;
 
 public:
-    TreeType(const std::string& name, const std::string& color, const std::string& texture)
+    TreeType(std::string_view name, std::string_view color, std::string_view texture)
         : name(name), color(color), texture(texture) {}
 
+    const std::string& getName() const { return name; }
+    const std::string& getColor() const { return color; }
+    const std::string& getTexture() const { return texture; }
+
     void draw(int x, int y) const {
         std::cout << "Drawing " << color << " " << name << " tree at (" << x << "," << y
                   << ") with " << texture << " texture" << std::endl;
     }
+
+    // Draw every tree of this type in one call: the shared state is set up once
+    void drawBatch(const int* xs, const int* ys, size_t count) const {
+        std::cout << "Drawing " << count << " " << color << " " << name << " trees with " << texture
+                  << " texture at";
+        for (size_t i = 0; i < count; ++i) {
+            std::cout << " (" << xs[i] << "," << ys[i] << ")";
+        }
+        std::cout << std::endl;
+    }
 };
 
+// Dense handle for an interned TreeType; index into the factory's table
+using TreeTypeId = uint32_t;
+
 // Flyweight factory
 class TreeTypeFactory {
 private:
-    std::unordered_map<std::string, std::unique_ptr<TreeType>> treeTypes;
+    // Views into the strings owned by the TreeType itself, so lookups need no key string
+    struct Key {
+        std::string_view name, color, texture;
 
-    std::string getKey(const std::string& name, const std::string& color, const std::string& texture) {
-        return name + "|" + color + "|" + texture;
-    }
+        bool operator==(const Key& other) const {
+            return name == other.name && color == other.color && texture == other.texture;
+        }
+    };
 
-public:
-    const TreeType& getTreeType(const std::string& name, const std::string& color, const std::string& texture) {
-        std::string key = getKey(name, color, texture);
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            std::hash<std::string_view> hash;
+            size_t h = hash(key.name);
+            h ^= hash(key.color) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            h ^= hash(key.texture) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    std::vector<std::unique_ptr<TreeType>> treeTypes;  // Indexed by TreeTypeId
+    std::unordered_map<Key, TreeTypeId, KeyHash> ids;
 
-        auto it = treeTypes.find(key);
-        if (it == treeTypes.end()) {
-            treeTypes[key] = std::make_unique<TreeType>(name, color, texture);
+public:
+    // One hash lookup, and no allocation unless the type is new
+    TreeTypeId intern(std::string_view name, std::string_view color, std::string_view texture) {
+        auto it = ids.find(Key{name, color, texture});
+        if (it != ids.end()) {
+            return it->second;
+        }
+        if (treeTypes.size() == std::numeric_limits<TreeTypeId>::max()) {
+            throw std::length_error("Too many tree types");
         }
+        auto id = static_cast<TreeTypeId>(treeTypes.size());
+        treeTypes.push_back(std::make_unique<TreeType>(name, color, texture));
+        const TreeType& type = *treeTypes.back();
+        ids.emplace(Key{type.getName(), type.getColor(), type.getTexture()}, id);
+        return id;
+    }
+
+    const TreeType& getTreeType(std::string_view name, std::string_view color, std::string_view texture) {
+        return *treeTypes[intern(name, color, texture)];
+    }
 
-        return *treeTypes[key];
+    const TreeType& getTreeType(TreeTypeId id) const {
+        if (id >= treeTypes.size()) {
+            throw std::out_of_range("Unknown tree type id");
+        }
+        return *treeTypes[id];
     }
 
     size_t getTreeTypeCount() const {
@@ -943,7 +1640,7 @@ public:
     }
 };
 
-// Context class
+// Context class: extrinsic state plus a pointer to the shared flyweight
 class Tree {
 private:
     int x, y;
@@ -957,31 +1654,288 @@ public:
     }
 };
 
-// Forest with many trees
+/**
+ * Forest with many trees, stored as struct-of-arrays: x, y and type id live
+ * in separate columns (12 bytes per tree instead of a 16-byte Tree), and
+ * Tree objects are built on demand only when one is needed.
+ *
+ * groupByType() reorders the columns so each type is one contiguous run;
+ * forEachTypeBatch() then hands every run to a callback in one call, which
+ * is how a renderer would bind a texture once per type.
+ *
+ * enableSpatialIndex() adds a uniform grid of cell_size x cell_size buckets,
+ * so forEachInRect() only looks at trees in cells touching the query
+ * rectangle instead of scanning the whole forest.
+ */
 class Forest {
 private:
-    std::vector<Tree> trees;
+    std::vector<int> xs;
+    std::vector<int> ys;
+    std::vector<TreeTypeId> typeIds;
     TreeTypeFactory treeTypeFactory;
 
+    std::vector<size_t> typeRuns;  // Run starts by type id (plus end) when grouped, else empty
+
+    int cellSize = 0;              // 0 while the spatial index is disabled
+    std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    int minCellX = 0, maxCellX = -1;  // Bounds of the occupied cells (empty while min > max)
+    int minCellY = 0, maxCellY = -1;
+
+    static int floorDiv(int value, int divisor) {
+        int q = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? q - 1 : q;
+    }
+
+    static uint64_t cellKey(int cx, int cy) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    void addToIndex(size_t i) {
+        int cx = floorDiv(xs[i], cellSize), cy = floorDiv(ys[i], cellSize);
+        if (cells.empty()) {
+            minCellX = maxCellX = cx;
+            minCellY = maxCellY = cy;
+        } else {
+            minCellX = std::min(minCellX, cx);
+            maxCellX = std::max(maxCellX, cx);
+            minCellY = std::min(minCellY, cy);
+            maxCellY = std::max(maxCellY, cy);
+        }
+        cells[cellKey(cx, cy)].push_back(static_cast<uint32_t>(i));
+    }
+
+    void rebuildIndex() {
+        cells.clear();
+        minCellX = minCellY = 0;
+        maxCellX = maxCellY = -1;
+        for (size_t i = 0; i < xs.size(); ++i) {
+            addToIndex(i);
+        }
+    }
+
 public:
-    void plantTree(int x, int y, const std::string& name, const std::string& color, const std::string& texture) {
-        const TreeType& type = treeTypeFactory.getTreeType(name, color, texture);
-        trees.emplace_back(x, y, type);
+    TreeTypeId internType(std::string_view name, std::string_view color, std::string_view texture) {
+        return treeTypeFactory.intern(name, color, texture);
+    }
+
+    void reserve(size_t count) {
+        xs.reserve(count);
+        ys.reserve(count);
+        typeIds.reserve(count);
+    }
+
+    void plantTree(int x, int y, TreeTypeId type) {
+        treeTypeFactory.getTreeType(type);  // Validates the id
+        if (xs.size() == std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("Forest is full");
+        }
+        xs.push_back(x);
+        ys.push_back(y);
+        typeIds.push_back(type);
+        typeRuns.clear();
+        if (cellSize > 0) {
+            addToIndex(xs.size() - 1);
+        }
+    }
+
+    void plantTree(int x, int y, std::string_view name, std::string_view color, std::string_view texture) {
+        plantTree(x, y, internType(name, color, texture));
+    }
+
+    size_t size() const { return xs.size(); }
+
+    Tree tree(size_t i) const {
+        return Tree(xs[i], ys[i], treeTypeFactory.getTreeType(typeIds[i]));
     }
 
     void draw() const {
-        for (const auto& tree : trees) {
-            tree.draw();
+        for (size_t i = 0; i < xs.size(); ++i) {
+            tree(i).draw();
+        }
+    }
+
+    // Stable counting sort of the columns by type id (keeps planting order within a type)
+    void groupByType() {
+        if (!typeRuns.empty()) {
+            return;
+        }
+        size_t typeCount = treeTypeFactory.getTreeTypeCount();
+        std::vector<size_t> starts(typeCount + 1, 0);
+        for (TreeTypeId id : typeIds) {
+            ++starts[id + 1];
+        }
+        for (size_t t = 0; t < typeCount; ++t) {
+            starts[t + 1] += starts[t];
+        }
+        std::vector<size_t> next(starts.begin(), starts.end() - 1);
+        std::vector<int> sortedXs(xs.size()), sortedYs(ys.size());
+        std::vector<TreeTypeId> sortedIds(typeIds.size());
+        for (size_t i = 0; i < typeIds.size(); ++i) {
+            size_t to = next[typeIds[i]]++;
+            sortedXs[to] = xs[i];
+            sortedYs[to] = ys[i];
+            sortedIds[to] = typeIds[i];
+        }
+        xs.swap(sortedXs);
+        ys.swap(sortedYs);
+        typeIds.swap(sortedIds);
+        typeRuns = std::move(starts);
+        if (cellSize > 0) {
+            rebuildIndex();  // Tree indices changed
+        }
+    }
+
+    // fn(const TreeType&, const int* xs, const int* ys, size_t count), once per type present
+    template<typename Fn>
+    void forEachTypeBatch(Fn&& fn) {
+        groupByType();
+        for (size_t t = 0; t + 1 < typeRuns.size(); ++t) {
+            size_t begin = typeRuns[t], count = typeRuns[t + 1] - begin;
+            if (count > 0) {
+                fn(treeTypeFactory.getTreeType(static_cast<TreeTypeId>(t)), xs.data() + begin, ys.data() + begin, count);
+            }
+        }
+    }
+
+    void drawBatched() {
+        forEachTypeBatch([](const TreeType& type, const int* x, const int* y, size_t count) {
+            type.drawBatch(x, y, count);
+        });
+    }
+
+    void enableSpatialIndex(int cell_size) {
+        if (cell_size <= 0) {
+            throw std::invalid_argument("cell_size must be positive");
+        }
+        cellSize = cell_size;
+        rebuildIndex();
+    }
+
+    // fn(x, y, const TreeType&) for every tree with x0 <= x <= x1 and y0 <= y <= y1
+    template<typename Fn>
+    void forEachInRect(int x0, int y0, int x1, int y1, Fn&& fn) const {
+        auto visit = [&](size_t i) {
+            if (xs[i] >= x0 && xs[i] <= x1 && ys[i] >= y0 && ys[i] <= y1) {
+                fn(xs[i], ys[i], treeTypeFactory.getTreeType(typeIds[i]));
+            }
+        };
+        auto scanColumns = [&] {
+            for (size_t i = 0; i < xs.size(); ++i) {
+                visit(i);
+            }
+        };
+        if (cellSize == 0) {
+            scanColumns();
+            return;
+        }
+        // Only cells inside the occupied bounds can hold trees. 64-bit counters so
+        // a query reaching INT_MAX with cell_size 1 cannot overflow.
+        int64_t cx0 = std::max(floorDiv(x0, cellSize), minCellX), cx1 = std::min(floorDiv(x1, cellSize), maxCellX);
+        int64_t cy0 = std::max(floorDiv(y0, cellSize), minCellY), cy1 = std::min(floorDiv(y1, cellSize), maxCellY);
+        if (cx0 > cx1 || cy0 > cy1) {
+            return;
+        }
+        // A rectangle spanning more cells than are occupied is cheaper to answer by scanning.
+        // width * height > occupied, written so the product (up to 2^64) never overflows.
+        uint64_t width = static_cast<uint64_t>(cx1 - cx0 + 1), height = static_cast<uint64_t>(cy1 - cy0 + 1);
+        if (width > cells.size() || height > cells.size() / width) {
+            scanColumns();
+            return;
+        }
+        for (int64_t cx = cx0; cx <= cx1; ++cx) {
+            for (int64_t cy = cy0; cy <= cy1; ++cy) {
+                auto it = cells.find(cellKey(static_cast<int>(cx), static_cast<int>(cy)));
+                if (it != cells.end()) {
+                    for (uint32_t i : it->second) {
+                        visit(i);
+                    }
+                }
+            }
         }
     }
 
+    size_t countInRect(int x0, int y0, int x1, int y1) const {
+        size_t count = 0;
+        forEachInRect(x0, y0, x1, y1, [&count](int, int, const TreeType&) { ++count; });
+        return count;
+    }
+
     void printStatistics() const {
-        std::cout << "Total trees: " << trees.size() << std::endl;
+        std::cout << "Total trees: " << xs.size() << std::endl;
         std::cout << "Unique tree types: " << treeTypeFactory.getTreeTypeCount() << std::endl;
-        std::cout << "Memory saved by sharing: " << (trees.size() - treeTypeFactory.getTreeTypeCount()) << " objects" << std::endl;
+        std::cout << "Memory saved by sharing: " << (xs.size() - treeTypeFactory.getTreeTypeCount()) << " objects" << std::endl;
+        std::cout << "Per-tree storage: " << 2 * sizeof(int) + sizeof(TreeTypeId) << " bytes in columns ("
+                  << sizeof(Tree) << " as a Tree object)" << std::endl;
+        if (cellSize > 0) {
+            std::cout << "Spatial index: " << cells.size() << " occupied cells of " << cellSize << "x" << cellSize
+                      << std::endl;
+        }
     }
 };
 
+void benchmark_flyweight() {
+    const int treeCount = 1000000;
+    const char* names[] = {"Oak", "Pine", "Maple", "Birch", "Willow", "Cedar", "Elm", "Ash"};
+    const char* colors[] = {"Green", "Dark Green", "Red", "Yellow"};
+    const char* textures[] = {"Rough", "Smooth"};
+    auto elapsed_ms = [](auto start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    // Scene description as it would come out of a loader
+    std::vector<std::array<std::string, 3>> scene;
+    scene.reserve(treeCount);
+    for (int i = 0; i < treeCount; ++i) {
+        scene.push_back({names[i % 8], colors[(i / 8) % 4], textures[(i / 32) % 2]});
+    }
+
+    // Previous approach: concatenated key, find() then operator[], array of Tree
+    auto start = std::chrono::high_resolution_clock::now();
+    std::unordered_map<std::string, std::unique_ptr<TreeType>> legacyTypes;
+    std::vector<Tree> legacyTrees;
+    legacyTrees.reserve(treeCount);
+    for (int i = 0; i < treeCount; ++i) {
+        const auto& [name, color, texture] = scene[i];
+        std::string key = name + "|" + color + "|" + texture;
+        if (legacyTypes.find(key) == legacyTypes.end()) {
+            legacyTypes[key] = std::make_unique<TreeType>(name, color, texture);
+        }
+        legacyTrees.emplace_back(i % 4096, i / 4096, *legacyTypes[key]);
+    }
+    std::cout << "Concatenated-key factory + Tree array: " << elapsed_ms(start) << " ms" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    Forest forest;
+    forest.reserve(treeCount);
+    for (int i = 0; i < treeCount; ++i) {
+        const auto& [name, color, texture] = scene[i];
+        forest.plantTree(i % 4096, i / 4096, name, color, texture);
+    }
+    std::cout << "string_view interning + columns:      " << elapsed_ms(start) << " ms" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    forest.groupByType();
+    long long checksum = 0;
+    size_t batches = 0;
+    forest.forEachTypeBatch([&](const TreeType&, const int* x, const int* y, size_t count) {
+        ++batches;
+        for (size_t i = 0; i < count; ++i) {
+            checksum += x[i] + y[i];
+        }
+    });
+    std::cout << "Group + batched iteration: " << elapsed_ms(start) << " ms (" << batches << " batches, checksum "
+              << checksum << ")" << std::endl;
+
+    start = std::chrono::high_resolution_clock::now();
+    size_t scanned = forest.countInRect(100, 10, 163, 41);
+    double scanMs = elapsed_ms(start);
+    forest.enableSpatialIndex(64);
+    start = std::chrono::high_resolution_clock::now();
+    size_t indexed = forest.countInRect(100, 10, 163, 41);
+    std::cout << "Range query: full scan " << scanMs << " ms, grid " << elapsed_ms(start) << " ms (" << indexed
+              << " trees" << (indexed == scanned ? "" : ", MISMATCH") << ")" << std::endl;
+}
+
 void demonstrate_flyweight() {
     std::cout << "=== FLYWEIGHT PATTERN ===" << std::endl;
 
@@ -1003,8 +1957,20 @@ void demonstrate_flyweight() {
     std::cout << "Drawing forest:" << std::endl;
     forest.draw();
 
+    std::cout << "\nDrawing forest one batch per type:" << std::endl;
+    forest.drawBatched();
+
+    forest.enableSpatialIndex(4);
+    std::cout << "\nTrees in (1,1)-(3,3):" << std::endl;
+    forest.forEachInRect(1, 1, 3, 3, [](int x, int y, const TreeType& type) {
+        std::cout << "  " << type.getName() << " at (" << x << "," << y << ")" << std::endl;
+    });
+
     std::cout << "\nMemory statistics:" << std::endl;
     forest.printStatistics();
+
+    std::cout << std::endl;
+    benchmark_flyweight();
     std::cout << std::endl;
 }
 
@@ -1028,53 +1994,277 @@ public:
 class RealImage : public Image {
 private:
     std::string filename;
+    std::chrono::milliseconds loadTime;
+    size_t sizeBytes;
 
     void loadFromDisk() {
-        std::cout << "Loading image " << filename << " from disk..." << std::endl;
+        // One insertion per line so loader threads don't interleave mid-line
+        std::cout << ("Loading image " + filename + " from disk...\n") << std::flush;
         // Simulate loading delay
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        std::this_thread::sleep_for(loadTime);
     }
 
 public:
-    explicit RealImage(const std::string& filename) : filename(filename) {
+    explicit RealImage(const std::string& filename, std::chrono::milliseconds loadTime = std::chrono::milliseconds(100),
+                       size_t sizeBytes = 1 << 20)
+        : filename(filename), loadTime(loadTime), sizeBytes(sizeBytes) {
         loadFromDisk();
     }
 
     void display() override {
-        std::cout << "Displaying image " << filename << std::endl;
+        std::cout << ("Displaying image " + filename + "\n") << std::flush;
     }
+
+    const std::string& getFilename() const { return filename; }
+    size_t getSizeBytes() const { return sizeBytes; }
 };
 
-// Proxy
-class ProxyImage : public Image {
-private:
-    std::string filename;
-    std::unique_ptr<RealImage> realImage;
+struct ImageCacheConfig {
+    size_t byte_budget = 64 << 20;   // Decoded bytes the cache may hold
+    size_t loader_threads = 2;
+    size_t prefetch_depth = 2;       // Gallery entries to prefetch past the one displayed
+    std::function<std::shared_ptr<RealImage>(const std::string&)> loader =
+        [](const std::string& filename) { return std::make_shared<RealImage>(filename); };
+};
 
-public:
-    explicit ProxyImage(const std::string& filename) : filename(filename) {}
+struct ImageCacheStats {
+    uint64_t hits = 0;           // Image was already loaded
+    uint64_t joined = 0;         // Waited for a load already in progress
+    uint64_t misses = 0;         // Loaded on the caller's thread
+    uint64_t prefetched = 0;     // Loads completed by background threads
+    uint64_t evictions = 0;
+    size_t bytes = 0;
+    size_t entries = 0;
+};
 
-    void display() override {
-        if (!realImage) {
-            realImage = std::make_unique<RealImage>(filename);
+/**
+ * Shared, byte-budgeted image cache for ProxyImage.
+ *
+ * Each file has at most one entry, and the entry holds a shared_future, so
+ * concurrent requests for the same file wait on one load instead of starting
+ * their own. prefetch() queues a load for the background threads; if get()
+ * reaches a queued entry before a loader does, the caller loads it itself
+ * rather than waiting behind the rest of the queue.
+ *
+ * Loaded images are kept in LRU order and the least recently used ones are
+ * evicted once their total size exceeds byte_budget. Callers hold images by
+ * shared_ptr, so an evicted image stays valid for whoever is displaying it.
+ */
+class ImageCache {
+private:
+    using ImagePtr = std::shared_ptr<RealImage>;
+    enum class State { Queued, Loading, Ready };
+
+    struct Entry {
+        State state = State::Queued;
+        std::promise<ImagePtr> promise;
+        std::shared_future<ImagePtr> image;
+        size_t bytes = 0;
+        std::list<std::string>::iterator lruPosition;  // Valid once Ready
+    };
+
+    ImageCacheConfig config;
+    std::mutex mutex;
+    std::condition_variable queue_cv;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entries;
+    std::list<std::string> lru;            // Ready entries, most recently used first
+    std::deque<std::string> prefetchQueue;
+    std::vector<std::thread> loaders;
+    bool stopping = false;
+    size_t bytes = 0;
+    ImageCacheStats counters;
+
+    // Called with mutex held after an entry became Ready
+    void evictOverBudget() {
+        while (bytes > config.byte_budget && lru.size() > 1) {
+            auto victim = entries.find(lru.back());
+            bytes -= victim->second->bytes;
+            entries.erase(victim);
+            lru.pop_back();
+            ++counters.evictions;
         }
-        realImage->display();
     }
-};
 
-// Image gallery using proxy
-class ImageGallery {
-private:
-    std::vector<std::unique_ptr<Image>> images;
+    // Runs the loader outside the lock and publishes the result to every waiter
+    void load(const std::string& filename, const std::shared_ptr<Entry>& entry) {
+        ImagePtr image;
+        try {
+            image = config.loader(filename);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mutex);
+            entry->promise.set_exception(std::current_exception());
+            auto it = entries.find(filename);
+            if (it != entries.end() && it->second == entry) {
+                entries.erase(it);  // Let a later request retry
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        entry->promise.set_value(image);
+        entry->state = State::Ready;
+        entry->bytes = image->getSizeBytes();
+        lru.push_front(filename);
+        entry->lruPosition = lru.begin();
+        bytes += entry->bytes;
+        evictOverBudget();
+    }
+
+    void loaderLoop() {
+        while (true) {
+            std::string filename;
+            std::shared_ptr<Entry> entry;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                queue_cv.wait(lock, [this] { return stopping || !prefetchQueue.empty(); });
+                if (stopping) {
+                    return;
+                }
+                filename = std::move(prefetchQueue.front());
+                prefetchQueue.pop_front();
+                auto it = entries.find(filename);
+                if (it == entries.end() || it->second->state != State::Queued) {
+                    continue;  // get() already claimed it
+                }
+                entry = it->second;
+                entry->state = State::Loading;
+            }
+            load(filename, entry);
+            std::lock_guard<std::mutex> lock(mutex);
+            ++counters.prefetched;
+        }
+    }
 
 public:
-    void addImage(const std::string& filename) {
-        images.push_back(std::make_unique<ProxyImage>(filename));
+    explicit ImageCache(ImageCacheConfig cfg = ImageCacheConfig()) : config(std::move(cfg)) {
+        if (!config.loader) {
+            throw std::invalid_argument("ImageCacheConfig::loader must be set");
+        }
+        for (size_t i = 0; i < config.loader_threads; ++i) {
+            loaders.emplace_back([this] { loaderLoop(); });
+        }
     }
 
-    void displayImage(int index) {
-        if (index >= 0 && index < images.size()) {
-            images[index]->display();
+    // Queued prefetches are abandoned; loads already running finish first
+    ~ImageCache() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        queue_cv.notify_all();
+        for (auto& loader : loaders) {
+            loader.join();
+        }
+    }
+
+    ImageCache(const ImageCache&) = delete;
+    ImageCache& operator=(const ImageCache&) = delete;
+
+    size_t prefetchDepth() const { return config.prefetch_depth; }
+
+    // Return the image, loading it at most once no matter how many threads ask
+    ImagePtr get(const std::string& filename) {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto it = entries.find(filename);
+        if (it == entries.end()) {
+            it = entries.emplace(filename, std::make_shared<Entry>()).first;
+            it->second->image = it->second->promise.get_future().share();
+        }
+        std::shared_ptr<Entry> entry = it->second;
+        switch (entry->state) {
+            case State::Ready:
+                ++counters.hits;
+                lru.splice(lru.begin(), lru, entry->lruPosition);
+                return entry->image.get();
+            case State::Loading:
+                ++counters.joined;
+                lock.unlock();
+                return entry->image.get();
+            case State::Queued:
+                ++counters.misses;
+                entry->state = State::Loading;
+                lock.unlock();
+                load(filename, entry);
+                return entry->image.get();
+        }
+        return nullptr;
+    }
+
+    // Start loading in the background if the image is neither cached nor on its way
+    void prefetch(const std::string& filename) {
+        if (config.loader_threads == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (entries.count(filename)) {
+                return;
+            }
+            auto entry = std::make_shared<Entry>();
+            entry->image = entry->promise.get_future().share();
+            entries.emplace(filename, std::move(entry));
+            prefetchQueue.push_back(filename);
+        }
+        queue_cv.notify_one();
+    }
+
+    ImageCacheStats stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        ImageCacheStats s = counters;
+        s.bytes = bytes;
+        s.entries = lru.size();
+        return s;
+    }
+};
+
+// Proxy
+class ProxyImage : public Image {
+private:
+    std::string filename;
+    std::unique_ptr<RealImage> realImage;
+    std::shared_ptr<ImageCache> cache;
+
+public:
+    // With a cache the proxy holds no image itself, so the cache's budget bounds memory
+    explicit ProxyImage(const std::string& filename, std::shared_ptr<ImageCache> cache = nullptr)
+        : filename(filename), cache(std::move(cache)) {}
+
+    void display() override {
+        if (cache) {
+            cache->get(filename)->display();
+            return;
+        }
+        if (!realImage) {
+            realImage = std::make_unique<RealImage>(filename);
+        }
+        realImage->display();
+    }
+};
+
+// Image gallery using proxy
+class ImageGallery {
+private:
+    std::vector<std::unique_ptr<Image>> images;
+    std::vector<std::string> filenames;
+    std::shared_ptr<ImageCache> cache;
+
+public:
+    explicit ImageGallery(std::shared_ptr<ImageCache> cache = nullptr) : cache(std::move(cache)) {}
+
+    void addImage(const std::string& filename) {
+        images.push_back(std::make_unique<ProxyImage>(filename, cache));
+        filenames.push_back(filename);
+    }
+
+    // With a cache, also prefetch the entries the user is likely to open next
+    void displayImage(int index) {
+        if (index < 0 || static_cast<size_t>(index) >= images.size()) {
+            return;
+        }
+        images[index]->display();
+        if (cache) {
+            for (size_t k = 1; k <= cache->prefetchDepth() && index + k < filenames.size(); ++k) {
+                cache->prefetch(filenames[index + k]);
+            }
         }
     }
 
@@ -1084,6 +2274,8 @@ public:
             images[i]->display();
         }
     }
+
+    size_t size() const { return images.size(); }
 };
 
 void demonstrate_proxy() {
@@ -1102,6 +2294,32 @@ void demonstrate_proxy() {
 
     std::cout << "\nDisplaying image 1 again (already loaded):" << std::endl;
     gallery.displayImage(0);  // Already loaded, no delay
+
+    std::cout << "\nBrowsing a gallery through a shared cache (3-image budget, prefetch 2):" << std::endl;
+    ImageCacheConfig config;
+    config.byte_budget = 3 << 20;
+    auto cache = std::make_shared<ImageCache>(config);
+    ImageGallery album(cache);
+    for (int i = 1; i <= 8; ++i) {
+        album.addImage("album" + std::to_string(i) + ".jpg");
+    }
+    double worstMs = 0, totalMs = 0;
+    for (size_t i = 0; i < album.size(); ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        album.displayImage(static_cast<int>(i));
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        totalMs += ms;
+        worstMs = i > 0 ? std::max(worstMs, ms) : worstMs;
+        std::this_thread::sleep_for(std::chrono::milliseconds(80));  // Time spent looking at the image
+    }
+    album.displayImage(0);  // Evicted by now: loads again
+
+    ImageCacheStats s = cache->stats();
+    std::cout << "Mean display latency " << totalMs / album.size() << " ms, worst after the first "
+              << worstMs << " ms" << std::endl;
+    std::cout << "Hits: " << s.hits << ", joined in-flight loads: " << s.joined << ", misses: " << s.misses
+              << ", prefetched: " << s.prefetched << ", evictions: " << s.evictions << ", cached: " << s.entries
+              << " images / " << (s.bytes >> 20) << " MiB" << std::endl;
     std::cout << std::endl;
 }
 
@@ -1203,12 +2421,19 @@ void demonstrate_chain_of_responsibility() {
  * Use Case: Undo/redo, macro operations, transactional behavior
  */
 
+// Scheduling hint honoured by CommandExecutor; higher levels run first
+enum class CommandPriority { Low = 0, Normal = 1, High = 2 };
+
 // Command interface
 class Command {
 public:
     virtual ~Command() = default;
     virtual void execute() = 0;
     virtual void undo() = 0;
+
+    // Scheduling hints for CommandExecutor; inline invokers ignore them
+    virtual CommandPriority priority() const { return CommandPriority::Normal; }
+    virtual int affinity() const { return -1; }  // Preferred worker index, -1 for any
 };
 
 // Receiver
@@ -1322,6 +2547,344 @@ public:
     }
 };
 
+/**
+ * Command adapter for a callable, so ad-hoc work can go through the executor.
+ * The optional reverse action becomes undo().
+ */
+class FunctionCommand : public Command {
+private:
+    std::function<void()> action;
+    std::function<void()> reverse;
+    CommandPriority level;
+    int preferred_worker;
+
+public:
+    explicit FunctionCommand(std::function<void()> action, std::function<void()> reverse = nullptr,
+                             CommandPriority level = CommandPriority::Normal, int preferred_worker = -1)
+        : action(std::move(action)), reverse(std::move(reverse)), level(level), preferred_worker(preferred_worker) {}
+
+    void execute() override { action(); }
+
+    void undo() override {
+        if (reverse) {
+            reverse();
+        }
+    }
+
+    CommandPriority priority() const override { return level; }
+    int affinity() const override { return preferred_worker; }
+};
+
+struct ExecutorStats {
+    std::vector<size_t> queue_lengths;  // Commands waiting in each worker's deques
+    size_t pending = 0;                 // Commands queued but not yet started
+    uint64_t executed = 0;
+    uint64_t steals = 0;                // Commands a worker took from another worker's deque
+    uint64_t wakeups = 0;               // notify calls issued to sleeping workers
+};
+
+/**
+ * Runs Commands on a work-stealing pool.
+ *
+ * Every worker owns a deque per priority level. A worker pops its own deques
+ * newest-first (the data it just queued is likely still in cache), and when
+ * they are empty it steals oldest-first from the others, highest priority
+ * first. Commands submitted from a worker thread go to that worker's deque;
+ * an affinity() hint routes a command to a specific worker instead, though
+ * an idle worker may still steal it.
+ *
+ * Each submission returns a future that yields the command back after
+ * execute() (ready for an undo history) or rethrows what execute() threw.
+ * submitBatch() queues many commands with a single wakeup of the pool
+ * rather than one per command.
+ */
+class CommandExecutor {
+private:
+    static constexpr size_t kPriorityLevels = 3;
+
+    struct Task {
+        std::unique_ptr<Command> command;
+        std::promise<std::unique_ptr<Command>> done;
+    };
+
+    struct alignas(64) Worker {
+        std::mutex mutex;
+        std::array<std::deque<Task>, kPriorityLevels> queues;  // Indexed by CommandPriority
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> steals{0};
+        std::thread thread;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic<size_t> pending{0};
+    std::atomic<size_t> sleepers{0};
+    std::atomic<uint64_t> wakeups{0};
+    std::atomic<size_t> next_worker{0};
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_cv;
+    bool stopping = false;
+
+    // Identifies the executor worker running on this thread, if any
+    struct WorkerContext {
+        const CommandExecutor* executor = nullptr;
+        size_t index = 0;
+    };
+    static WorkerContext& currentWorker() {
+        static thread_local WorkerContext context;
+        return context;
+    }
+
+    size_t chooseWorker(const Command& command) {
+        int hint = command.affinity();
+        if (hint >= 0) {
+            return static_cast<size_t>(hint) % workers.size();
+        }
+        const WorkerContext& context = currentWorker();
+        if (context.executor == this) {
+            return context.index;
+        }
+        return next_worker.fetch_add(1, std::memory_order_relaxed) % workers.size();
+    }
+
+    static size_t level(const Command& command) {
+        return std::min(static_cast<size_t>(command.priority()), kPriorityLevels - 1);
+    }
+
+    void push(size_t index, Task task) {
+        size_t band = level(*task.command);
+        std::lock_guard<std::mutex> lock(workers[index]->mutex);
+        workers[index]->queues[band].push_back(std::move(task));
+    }
+
+    // Wake sleeping workers after new tasks were made visible through pending
+    void wake(bool all) {
+        if (sleepers.load() == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+        }
+        if (all) {
+            sleep_cv.notify_all();
+        } else {
+            sleep_cv.notify_one();
+        }
+        wakeups.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool popLocal(Worker& worker, std::optional<Task>& task) {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        for (size_t band = kPriorityLevels; band-- > 0;) {
+            if (!worker.queues[band].empty()) {
+                task.emplace(std::move(worker.queues[band].back()));
+                worker.queues[band].pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool steal(size_t thief, std::optional<Task>& task) {
+        for (size_t band = kPriorityLevels; band-- > 0;) {
+            for (size_t offset = 1; offset < workers.size(); ++offset) {
+                Worker& victim = *workers[(thief + offset) % workers.size()];
+                std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+                if (lock.owns_lock() && !victim.queues[band].empty()) {
+                    task.emplace(std::move(victim.queues[band].front()));
+                    victim.queues[band].pop_front();
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    // Counted before the promise is fulfilled, so stats() after future.get() includes it
+    static void run(Task& task, Worker& worker) {
+        try {
+            task.command->execute();
+            worker.executed.fetch_add(1, std::memory_order_relaxed);
+            task.done.set_value(std::move(task.command));
+        } catch (...) {
+            worker.executed.fetch_add(1, std::memory_order_relaxed);
+            task.done.set_exception(std::current_exception());
+        }
+    }
+
+    void workerLoop(size_t index) {
+        currentWorker() = {this, index};
+        Worker& self = *workers[index];
+        while (true) {
+            std::optional<Task> task;
+            bool found = popLocal(self, task);
+            if (!found && steal(index, task)) {
+                found = true;
+                self.steals.fetch_add(1, std::memory_order_relaxed);
+            }
+            if (found) {
+                pending.fetch_sub(1);
+                run(*task, self);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleepers.fetch_add(1);
+            // A steal can miss a task behind a contended try_lock, so pending decides
+            sleep_cv.wait(lock, [this] { return stopping || pending.load() > 0; });
+            sleepers.fetch_sub(1);
+            if (stopping && pending.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit CommandExecutor(size_t thread_count = std::max(1u, std::thread::hardware_concurrency())) {
+        if (thread_count == 0) {
+            throw std::invalid_argument("CommandExecutor needs at least one thread");
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < thread_count; ++i) {
+            workers[i]->thread = std::thread(&CommandExecutor::workerLoop, this, i);
+        }
+    }
+
+    // Finishes every queued command before the workers exit
+    ~CommandExecutor() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        sleep_cv.notify_all();
+        for (auto& worker : workers) {
+            worker->thread.join();
+        }
+    }
+
+    CommandExecutor(const CommandExecutor&) = delete;
+    CommandExecutor& operator=(const CommandExecutor&) = delete;
+
+    std::future<std::unique_ptr<Command>> submit(std::unique_ptr<Command> command) {
+        if (!command) {
+            throw std::invalid_argument("Cannot submit a null command");
+        }
+        size_t index = chooseWorker(*command);
+        Task task{std::move(command), {}};
+        auto future = task.done.get_future();
+        pending.fetch_add(1);  // Before the push, so the task is never popped while pending is 0
+        push(index, std::move(task));
+        wake(false);
+        return future;
+    }
+
+    /**
+     * Queue all commands, then wake the pool once. Commands without an
+     * affinity hint are dealt out in contiguous runs, one run per worker.
+     */
+    std::vector<std::future<std::unique_ptr<Command>>> submitBatch(std::vector<std::unique_ptr<Command>> commands) {
+        for (const auto& command : commands) {
+            if (!command) {
+                throw std::invalid_argument("Cannot submit a null command");
+            }
+        }
+        std::vector<std::future<std::unique_ptr<Command>>> futures;
+        futures.reserve(commands.size());
+        size_t run_length = (commands.size() + workers.size() - 1) / workers.size();
+        size_t first_worker = next_worker.fetch_add(1, std::memory_order_relaxed);
+        pending.fetch_add(commands.size());
+        for (size_t i = 0; i < commands.size(); ++i) {
+            int hint = commands[i]->affinity();
+            size_t index = hint >= 0 ? static_cast<size_t>(hint) % workers.size()
+                                     : (first_worker + i / run_length) % workers.size();
+            Task task{std::move(commands[i]), {}};
+            futures.push_back(task.done.get_future());
+            push(index, std::move(task));
+        }
+        wake(true);
+        return futures;
+    }
+
+    size_t threadCount() const { return workers.size(); }
+
+    ExecutorStats stats() {
+        ExecutorStats s;
+        for (auto& worker : workers) {
+            size_t length = 0;
+            {
+                std::lock_guard<std::mutex> lock(worker->mutex);
+                for (const auto& queue : worker->queues) {
+                    length += queue.size();
+                }
+            }
+            s.queue_lengths.push_back(length);
+            s.executed += worker->executed.load(std::memory_order_relaxed);
+            s.steals += worker->steals.load(std::memory_order_relaxed);
+        }
+        s.pending = pending.load();
+        s.wakeups = wakeups.load(std::memory_order_relaxed);
+        return s;
+    }
+};
+
+void benchmark_command_executor() {
+    const int count = 2000;
+    std::atomic<long> checksum{0};
+    auto work = [&checksum] {
+        long x = 0;
+        for (int i = 0; i < 2000; ++i) {
+            x += i * i % 7;
+        }
+        checksum += x;
+    };
+    auto elapsed_ms = [](auto start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    // Baseline: one std::thread per command
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int i = 0; i < count; ++i) {
+        threads.emplace_back([&work] { FunctionCommand(work).execute(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::cout << "Thread per command: " << elapsed_ms(start) << " ms" << std::endl;
+
+    CommandExecutor executor(4);
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<std::future<std::unique_ptr<Command>>> futures;
+    for (int i = 0; i < count; ++i) {
+        futures.push_back(executor.submit(std::make_unique<FunctionCommand>(work)));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    std::cout << "Executor submit():   " << elapsed_ms(start) << " ms, wakeups " << executor.stats().wakeups
+              << std::endl;
+
+    uint64_t wakeups_before = executor.stats().wakeups;
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<std::unique_ptr<Command>> batch;
+    for (int i = 0; i < count; ++i) {
+        batch.push_back(std::make_unique<FunctionCommand>(work));
+    }
+    futures = executor.submitBatch(std::move(batch));
+    for (auto& future : futures) {
+        future.get();
+    }
+    ExecutorStats s = executor.stats();
+    std::cout << "Executor submitBatch(): " << elapsed_ms(start) << " ms, wakeups " << s.wakeups - wakeups_before
+              << std::endl;
+    std::cout << "Executed " << s.executed << " commands, " << s.steals << " steals, queue lengths:";
+    for (size_t length : s.queue_lengths) {
+        std::cout << " " << length;
+    }
+    std::cout << std::endl;
+}
+
 void demonstrate_command() {
     std::cout << "=== COMMAND PATTERN ===" << std::endl;
 
@@ -1346,6 +2909,25 @@ void demonstrate_command() {
 
     std::cout << "\nPressing UNDO button again:" << std::endl;
     remote.undo();
+
+    std::cout << "\nRunning commands on a CommandExecutor:" << std::endl;
+    {
+        CommandExecutor executor(2);
+        // The future hands the executed command back, so it can still be undone
+        auto lightOn = executor.submit(std::make_unique<LightOnCommand>(livingRoomLight));
+        std::unique_ptr<Command> executed = lightOn.get();
+        executed->undo();
+
+        auto failing = executor.submit(std::make_unique<FunctionCommand>(
+            [] { throw std::runtime_error("device offline"); }, nullptr, CommandPriority::High));
+        try {
+            failing.get();
+        } catch (const std::exception& e) {
+            std::cout << "Command failed: " << e.what() << std::endl;
+        }
+    }
+
+    benchmark_command_executor();
     std::cout << std::endl;
 }
 
@@ -1441,35 +3023,361 @@ void demonstrate_iterator() {
 // Observer interface
 class Observer {
 public:
+    using MessageBatch = std::vector<std::reference_wrapper<const std::string>>;
+
     virtual ~Observer() = default;
     virtual void update(const std::string& message) = 0;
+
+    // Asynchronous dispatch hands over everything queued for this observer at once;
+    // override to handle a burst with one write, redraw or network call
+    virtual void updateBatch(const MessageBatch& messages) {
+        for (const std::string& message : messages) {
+            update(message);
+        }
+    }
 };
 
-// Subject interface
+// Fixed-size thread pool that runs asynchronous notification deliveries
+class DispatchPool {
+private:
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopping = false;
+
+    void run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+
+public:
+    explicit DispatchPool(size_t threads = std::max(2u, std::thread::hardware_concurrency())) {
+        for (size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this] { run(); });
+        }
+    }
+
+    // Runs every task already submitted before joining
+    ~DispatchPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    DispatchPool(const DispatchPool&) = delete;
+    DispatchPool& operator=(const DispatchPool&) = delete;
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push(std::move(task));
+        }
+        cv.notify_one();
+    }
+};
+
+// Delivery counters for one observer (asynchronous mode)
+struct ObserverStats {
+    Observer* observer = nullptr;
+    size_t queue_depth = 0;        // Messages waiting right now
+    size_t max_queue_depth = 0;
+    uint64_t delivered = 0;
+    uint64_t batches = 0;          // updateBatch() calls
+    uint64_t discarded = 0;        // Still queued when the observer detached
+    double mean_latency_us = 0;    // notify() -> start of updateBatch()
+    double max_latency_us = 0;
+};
+
+/**
+ * Subject interface
+ *
+ * The subscriber list is copy-on-write: attach/detach build a new immutable
+ * snapshot and swap it in atomically, so notify() never takes a lock to read
+ * it. A snapshot is freed once no reader can still hold it (tracked by a
+ * reader count); until then it waits on a retired list.
+ *
+ * By default notify() calls every observer on the publishing thread. After
+ * enableAsyncDispatch() it only appends the message to an inbox: a pool task
+ * fans the inbox out to per-observer queues, and each observer drains its own
+ * queue on the pool in batches of up to max_batch, so a slow observer delays
+ * only itself and publish cost does not grow with the number of subscribers.
+ * Each observer still sees messages in publish order, one batch at a time.
+ */
 class Subject {
 private:
-    std::vector<Observer*> observers;
-    std::mutex observers_mutex;
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedMessage {
+        std::shared_ptr<const std::string> text;  // Shared by every observer's queue
+        Clock::time_point published;
+    };
+
+    // Per-observer delivery state, shared with in-flight pool tasks
+    struct Subscription {
+        Observer* observer;
+        std::atomic<bool> active{true};
+        std::atomic<int> callbacks{0};        // Synchronous update() calls in progress
+
+        std::mutex mutex;                     // Guards everything below
+        std::condition_variable idle_cv;
+        std::deque<QueuedMessage> queue;
+        bool scheduled = false;               // A delivery task is queued or running
+        ObserverStats stats;
+        double latency_us_total = 0;
+
+        explicit Subscription(Observer* observer) : observer(observer) {
+            stats.observer = observer;
+        }
+    };
+
+    using Snapshot = std::vector<std::shared_ptr<Subscription>>;
+
+    std::atomic<const Snapshot*> snapshot{new Snapshot()};
+    std::atomic<size_t> readers{0};
+    std::mutex writers_mutex;                 // Serializes attach/detach only
+    std::vector<const Snapshot*> retired;
+
+    std::shared_ptr<DispatchPool> pool;
+    size_t max_batch = 64;
+    std::mutex inbox_mutex;
+    std::condition_variable inbox_idle_cv;
+    std::vector<QueuedMessage> inbox;
+    bool fan_out_scheduled = false;
+
+    // Pins the current snapshot for the lifetime of the guard
+    class SnapshotGuard {
+    private:
+        Subject& subject;
+        const Snapshot* pinned;
+
+    public:
+        explicit SnapshotGuard(Subject& subject) : subject(subject) {
+            subject.readers.fetch_add(1);     // seq_cst: ordered before the load
+            pinned = subject.snapshot.load();
+        }
+        ~SnapshotGuard() { subject.readers.fetch_sub(1, std::memory_order_release); }
+
+        const Snapshot& operator*() const { return *pinned; }
+    };
+
+    // Called with writers_mutex held
+    void replaceSnapshot(const Snapshot* next) {
+        retired.push_back(snapshot.exchange(next));
+        // A reader arriving after the exchange can only see next, so if none are
+        // active now, nobody can still be looking at a retired snapshot
+        if (readers.load() == 0) {
+            for (const Snapshot* old : retired) {
+                delete old;
+            }
+            retired.clear();
+        }
+    }
+
+    void publishAsync(const std::string& message) {
+        bool schedule;
+        {
+            std::lock_guard<std::mutex> lock(inbox_mutex);
+            inbox.push_back({std::make_shared<const std::string>(message), Clock::now()});
+            schedule = !fan_out_scheduled;
+            fan_out_scheduled = true;
+        }
+        if (schedule) {
+            pool->submit([this] { fanOut(); });
+        }
+    }
+
+    // Move inbox messages into every observer's queue; one task at a time keeps publish order
+    void fanOut() {
+        std::vector<QueuedMessage> batch;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(inbox_mutex);
+                if (inbox.empty()) {
+                    fan_out_scheduled = false;
+                    inbox_idle_cv.notify_all();
+                    return;
+                }
+                batch.swap(inbox);
+            }
+            SnapshotGuard current(*this);
+            for (const auto& sub : *current) {
+                enqueue(sub, batch);
+            }
+            batch.clear();
+        }
+    }
+
+    void enqueue(const std::shared_ptr<Subscription>& sub, const std::vector<QueuedMessage>& messages) {
+        {
+            std::lock_guard<std::mutex> lock(sub->mutex);
+            if (!sub->active) {
+                return;
+            }
+            sub->queue.insert(sub->queue.end(), messages.begin(), messages.end());
+            sub->stats.max_queue_depth = std::max(sub->stats.max_queue_depth, sub->queue.size());
+            if (sub->scheduled) {
+                return;  // The running delivery task will pick these up
+            }
+            sub->scheduled = true;
+        }
+        // Raw pool pointer: a task must never own the pool it runs on. The Subject keeps it
+        // alive, and waitIdle() in ~Subject() outlasts any task that still submits.
+        pool->submit([pool = pool.get(), sub, max_batch = max_batch] { deliver(pool, sub, max_batch); });
+    }
+
+    // Deliver one batch, then requeue behind other work if more is waiting
+    static void deliver(DispatchPool* pool, const std::shared_ptr<Subscription>& sub, size_t max_batch) {
+        std::vector<QueuedMessage> taken;
+        {
+            std::lock_guard<std::mutex> lock(sub->mutex);
+            size_t n = std::min(max_batch, sub->queue.size());
+            taken.assign(std::make_move_iterator(sub->queue.begin()),
+                         std::make_move_iterator(sub->queue.begin() + n));
+            sub->queue.erase(sub->queue.begin(), sub->queue.begin() + n);
+        }
+
+        auto start = Clock::now();
+        if (!taken.empty()) {
+            Observer::MessageBatch batch;
+            batch.reserve(taken.size());
+            for (const auto& message : taken) {
+                batch.push_back(std::cref(*message.text));
+            }
+            sub->observer->updateBatch(batch);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(sub->mutex);
+            for (const auto& message : taken) {
+                double us = std::chrono::duration<double, std::micro>(start - message.published).count();
+                sub->latency_us_total += us;
+                sub->stats.max_latency_us = std::max(sub->stats.max_latency_us, us);
+            }
+            sub->stats.delivered += taken.size();
+            sub->stats.batches += taken.empty() ? 0 : 1;
+            if (sub->queue.empty() || !sub->active) {
+                sub->scheduled = false;
+                sub->idle_cv.notify_all();
+                return;
+            }
+        }
+        pool->submit([pool, sub, max_batch] { deliver(pool, sub, max_batch); });
+    }
 
 public:
-    virtual ~Subject() = default;
+    Subject() = default;
+    Subject(const Subject&) = delete;
+    Subject& operator=(const Subject&) = delete;
+
+    virtual ~Subject() {
+        waitIdle();
+        delete snapshot.load();
+        for (const Snapshot* old : retired) {
+            delete old;
+        }
+    }
+
+    /**
+     * Deliver notifications on pool threads instead of the publishing thread.
+     * Call before publishing starts. max_batch bounds how many queued messages
+     * one updateBatch() call receives.
+     */
+    void enableAsyncDispatch(std::shared_ptr<DispatchPool> dispatch_pool, size_t batch_limit = 64) {
+        if (!dispatch_pool || batch_limit == 0) {
+            throw std::invalid_argument("enableAsyncDispatch needs a pool and a positive batch limit");
+        }
+        pool = std::move(dispatch_pool);
+        max_batch = batch_limit;
+    }
 
     void attach(Observer* observer) {
-        std::lock_guard<std::mutex> lock(observers_mutex);
-        observers.push_back(observer);
+        std::lock_guard<std::mutex> lock(writers_mutex);
+        auto next = new Snapshot(*snapshot.load());
+        next->push_back(std::make_shared<Subscription>(observer));
+        replaceSnapshot(next);
     }
 
+    // Once this returns the observer receives no further calls and may be destroyed.
+    // Waits only for that observer's own in-progress update, not for other subscribers.
     void detach(Observer* observer) {
-        std::lock_guard<std::mutex> lock(observers_mutex);
-        observers.erase(std::remove(observers.begin(), observers.end(), observer), observers.end());
+        Snapshot removed;
+        {
+            std::lock_guard<std::mutex> lock(writers_mutex);
+            auto next = new Snapshot();
+            for (const auto& sub : *snapshot.load()) {
+                (sub->observer == observer ? removed : *next).push_back(sub);
+            }
+            replaceSnapshot(next);
+        }
+        for (const auto& sub : removed) {
+            sub->active.store(false);
+            while (sub->callbacks.load() != 0) {
+                std::this_thread::yield();
+            }
+            std::unique_lock<std::mutex> lock(sub->mutex);
+            sub->stats.discarded += sub->queue.size();
+            sub->queue.clear();
+            sub->idle_cv.wait(lock, [&] { return !sub->scheduled; });
+        }
     }
 
     void notify(const std::string& message) {
-        std::lock_guard<std::mutex> lock(observers_mutex);
-        for (Observer* observer : observers) {
-            observer->update(message);
+        if (pool) {
+            publishAsync(message);
+            return;
+        }
+        SnapshotGuard current(*this);
+        for (const auto& sub : *current) {
+            sub->callbacks.fetch_add(1);
+            if (sub->active.load()) {
+                sub->observer->update(message);
+            }
+            sub->callbacks.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    // Block until every message published so far has been delivered
+    void waitIdle() {
+        {
+            std::unique_lock<std::mutex> lock(inbox_mutex);
+            inbox_idle_cv.wait(lock, [this] { return !fan_out_scheduled; });
+        }
+        SnapshotGuard current(*this);
+        for (const auto& sub : *current) {
+            std::unique_lock<std::mutex> lock(sub->mutex);
+            sub->idle_cv.wait(lock, [&] { return !sub->scheduled; });
         }
     }
+
+    std::vector<ObserverStats> observerStats() {
+        std::vector<ObserverStats> result;
+        SnapshotGuard current(*this);
+        for (const auto& sub : *current) {
+            std::lock_guard<std::mutex> lock(sub->mutex);
+            ObserverStats s = sub->stats;
+            s.queue_depth = sub->queue.size();
+            s.mean_latency_us = s.delivered ? sub->latency_us_total / s.delivered : 0;
+            result.push_back(s);
+        }
+        return result;
+    }
 };
 
 // Concrete subject
@@ -1509,6 +3417,71 @@ public:
     }
 };
 
+// Observer with a fixed cost per call, e.g. a network push or a redraw
+class SlowSubscriber : public Observer {
+private:
+    std::chrono::microseconds cost;
+    std::atomic<size_t> received{0};
+
+public:
+    explicit SlowSubscriber(std::chrono::microseconds cost) : cost(cost) {}
+
+    void update(const std::string&) override {
+        ++received;
+        std::this_thread::sleep_for(cost);
+    }
+
+    // One round trip for the whole batch
+    void updateBatch(const MessageBatch& messages) override {
+        received += messages.size();
+        std::this_thread::sleep_for(cost);
+    }
+
+    size_t messagesReceived() const { return received; }
+};
+
+void benchmark_observer_dispatch() {
+    const int messages = 50;
+    const auto cost = std::chrono::microseconds(100);
+    auto pool = std::make_shared<DispatchPool>(4);
+
+    std::cout << "\nPublish latency with " << cost.count() << " us subscribers:" << std::endl;
+    for (int subscribers : {1, 8, 32}) {
+        for (bool async : {false, true}) {
+            NewsAgency agency;
+            if (async) {
+                agency.enableAsyncDispatch(pool);
+            }
+            std::vector<std::unique_ptr<SlowSubscriber>> subs;
+            for (int i = 0; i < subscribers; ++i) {
+                subs.push_back(std::make_unique<SlowSubscriber>(cost));
+                agency.attach(subs.back().get());
+            }
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int m = 0; m < messages; ++m) {
+                agency.setNews("tick " + std::to_string(m));
+            }
+            auto published = std::chrono::high_resolution_clock::now();
+            agency.waitIdle();
+
+            ObserverStats first = agency.observerStats().front();
+            std::cout << "  " << std::setw(2) << subscribers << " subscribers, " << (async ? "async" : "sync ")
+                      << ": " << std::chrono::duration<double, std::micro>(published - start).count() / messages
+                      << " us/publish";
+            if (async) {
+                std::cout << " (first observer: " << first.delivered << " messages in " << first.batches
+                          << " batches, max queue " << first.max_queue_depth << ", mean latency "
+                          << first.mean_latency_us << " us)";
+            }
+            std::cout << std::endl;
+            for (auto& sub : subs) {
+                agency.detach(sub.get());
+            }
+        }
+    }
+}
+
 void demonstrate_observer() {
     std::cout << "=== OBSERVER PATTERN ===" << std::endl;
 
@@ -1534,6 +3507,8 @@ void demonstrate_observer() {
     std::cout << "\nRemoving CNN and third update:" << std::endl;
     newsAgency.detach(&cnn);
     newsAgency.setNews("New technology breakthrough revealed!");
+
+    benchmark_observer_dispatch();
     std::cout << std::endl;
 }
 
@@ -1662,8 +3637,276 @@ void demonstrate_strategy() {
  * Use Case: Frameworks, algorithms with fixed structure, data processing pipelines
  */
 
+// Supplies input for DataProcessor::processStream() as chunks of whole records
+class ChunkSource {
+public:
+    virtual ~ChunkSource() = default;
+
+    // Produce the next chunk, ending on a record boundary. The chunk may point into
+    // buffer (which the caller owns and reuses) or into memory the source owns; it
+    // must stay valid until next() is called again with the same buffer.
+    virtual bool next(std::string& buffer, std::string_view& chunk) = 0;
+};
+
+// Splits an in-memory string into chunks of about chunkBytes
+class StringChunkSource : public ChunkSource {
+private:
+    std::string_view data;
+    size_t chunkBytes;
+    size_t offset = 0;
+
+public:
+    explicit StringChunkSource(std::string_view data, size_t chunkBytes = 1 << 20)
+        : data(data), chunkBytes(std::max<size_t>(chunkBytes, 1)) {}
+
+    bool next(std::string&, std::string_view& chunk) override {
+        if (offset >= data.size()) {
+            return false;
+        }
+        size_t end = std::min(offset + chunkBytes, data.size());
+        size_t newline = data.find('\n', end - 1);
+        end = newline == std::string_view::npos ? data.size() : newline + 1;
+        chunk = data.substr(offset, end - offset);
+        offset = end;
+        return true;
+    }
+};
+
+// Reads a file chunkBytes at a time; a record cut by a chunk boundary is carried over
+class FileChunkSource : public ChunkSource {
+private:
+    std::FILE* file;
+    std::string path;
+    size_t chunkBytes;
+    std::string carry;
+
+public:
+    explicit FileChunkSource(const std::string& path, size_t chunkBytes = 1 << 20)
+        : file(std::fopen(path.c_str(), "rb")), path(path), chunkBytes(std::max<size_t>(chunkBytes, 1)) {
+        if (!file) {
+            throw std::runtime_error("Failed to open " + path);
+        }
+    }
+
+    ~FileChunkSource() override { std::fclose(file); }
+
+    FileChunkSource(const FileChunkSource&) = delete;
+    FileChunkSource& operator=(const FileChunkSource&) = delete;
+
+    bool next(std::string& buffer, std::string_view& chunk) override {
+        buffer.assign(carry);
+        carry.clear();
+        while (true) {
+            size_t old = buffer.size();
+            buffer.resize(old + chunkBytes);
+            size_t got = std::fread(&buffer[old], 1, chunkBytes, file);
+            buffer.resize(old + got);
+            if (std::ferror(file)) {
+                // A short read is only EOF if no error is flagged; otherwise the aggregates would be partial
+                throw std::runtime_error("Read failed on " + path);
+            }
+            if (got == 0) {
+                chunk = buffer;  // Last record may lack a trailing newline
+                return !buffer.empty();
+            }
+            size_t newline = buffer.rfind('\n');
+            if (newline != std::string::npos) {
+                carry.assign(buffer, newline + 1, std::string::npos);
+                buffer.resize(newline + 1);
+                chunk = buffer;
+                return true;
+            }
+            // No record boundary yet: a record longer than chunkBytes, keep reading
+        }
+    }
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Memory-maps a file and hands out views straight into the mapping, so no
+ * bytes are copied. Pages are clean file cache: the kernel can drop ones
+ * already processed, so a multi-GB file does not pin multi-GB of RAM.
+ */
+class MappedFileSource : public ChunkSource {
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    size_t offset = 0;
+    size_t chunkBytes;
+
+public:
+    explicit MappedFileSource(const std::string& path, size_t chunkBytes = 1 << 20)
+        : chunkBytes(std::max<size_t>(chunkBytes, 1)) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Failed to open " + path);
+        }
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Failed to stat " + path);
+        }
+        size = static_cast<size_t>(info.st_size);
+        if (size > 0) {
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Failed to map " + path);
+            }
+            ::madvise(mapping, size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(mapping);
+        }
+        ::close(fd);  // The mapping keeps the file referenced
+    }
+
+    ~MappedFileSource() override {
+        if (data) {
+            ::munmap(const_cast<char*>(data), size);
+        }
+    }
+
+    MappedFileSource(const MappedFileSource&) = delete;
+    MappedFileSource& operator=(const MappedFileSource&) = delete;
+
+    bool next(std::string&, std::string_view& chunk) override {
+        if (offset >= size) {
+            return false;
+        }
+        size_t end = std::min(offset + chunkBytes, size);
+        if (end < size) {
+            const void* newline = std::memchr(data + end - 1, '\n', size - end + 1);
+            end = newline ? static_cast<size_t>(static_cast<const char*>(newline) - data) + 1 : size;
+        }
+        chunk = std::string_view(data + offset, end - offset);
+        offset = end;
+        return true;
+    }
+};
+#endif
+
+// Result of transforming one chunk; each processor defines its own
+class PartialResult {
+public:
+    virtual ~PartialResult() = default;
+};
+
+struct StreamOptions {
+    size_t threads = 0;        // Workers running transformChunk; 0 = hardware concurrency
+    size_t max_in_flight = 0;  // Chunks read but not yet merged; 0 = 2 * threads
+};
+
+struct StreamStats {
+    size_t chunks = 0;
+    size_t bytes = 0;
+    size_t max_in_flight = 0;  // Upper bound on chunk buffers alive at once
+};
+
 // Abstract class with template method
 class DataProcessor {
+private:
+    // Read chunks on this thread, transform them on workers, merge partials in chunk
+    // order. Chunk i uses buffer slot i % max_in_flight, and no chunk is read until
+    // the one max_in_flight places before it has been merged, which bounds memory.
+    StreamStats runPipeline(ChunkSource& source, const StreamOptions& options) {
+        size_t threads = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+        size_t window = options.max_in_flight ? options.max_in_flight : 2 * threads;
+
+        struct Slot {
+            std::string buffer;
+            std::string_view chunk;
+            std::unique_ptr<PartialResult> partial;
+            std::exception_ptr error;
+            bool done = false;
+        };
+        std::vector<Slot> slots(window);
+        std::mutex mutex;
+        std::condition_variable work_cv, done_cv;
+        std::queue<size_t> work;
+        bool closing = false;
+
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&] {
+                while (true) {
+                    size_t index;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        work_cv.wait(lock, [&] { return closing || !work.empty(); });
+                        if (work.empty()) {
+                            return;
+                        }
+                        index = work.front();
+                        work.pop();
+                    }
+                    Slot& slot = slots[index % window];
+                    try {
+                        slot.partial = transformChunk(slot.chunk);
+                    } catch (...) {
+                        slot.error = std::current_exception();
+                    }
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        slot.done = true;
+                    }
+                    done_cv.notify_one();
+                }
+            });
+        }
+
+        StreamStats stats;
+        stats.max_in_flight = window;
+        std::exception_ptr failure;
+        size_t nextRead = 0, nextMerge = 0;
+        bool exhausted = false;
+        try {
+            while (!exhausted || nextMerge < nextRead) {
+                if (!exhausted && nextRead - nextMerge < window) {
+                    Slot& slot = slots[nextRead % window];
+                    if (!source.next(slot.buffer, slot.chunk)) {
+                        exhausted = true;
+                        continue;
+                    }
+                    stats.bytes += slot.chunk.size();
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        work.push(nextRead++);
+                    }
+                    work_cv.notify_one();
+                    continue;
+                }
+                Slot& slot = slots[nextMerge % window];
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    done_cv.wait(lock, [&] { return slot.done; });
+                    slot.done = false;
+                }
+                if (slot.error) {
+                    std::rethrow_exception(slot.error);
+                }
+                mergePartial(*slot.partial);
+                slot.partial.reset();
+                ++nextMerge;
+                ++stats.chunks;
+            }
+        } catch (...) {
+            failure = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closing = true;
+            std::queue<size_t>().swap(work);  // Drop chunks not started yet
+        }
+        work_cv.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        return stats;
+    }
+
 public:
     // Template method - defines the algorithm structure
     void processData() {
@@ -1678,6 +3921,34 @@ public:
         cleanup();
     }
 
+    /**
+     * Streaming form of the same template. Instead of loading the whole
+     * dataset, chunks from source flow through a bounded pipeline:
+     * transformChunk() turns each chunk into a PartialResult on a worker
+     * thread, and mergePartial() folds them together in input order on the
+     * calling thread. calculateResults()/displayResults() then run once on
+     * the merged result. Memory stays at max_in_flight chunks however large
+     * the input is.
+     */
+    StreamStats processStream(ChunkSource& source, const StreamOptions& options = StreamOptions()) {
+        beginStream();
+        StreamStats stats;
+        try {
+            stats = runPipeline(source, options);
+        } catch (...) {
+            cleanup();
+            throw;
+        }
+        if (validateData()) {
+            calculateResults();
+            displayResults();
+        } else {
+            std::cout << "Data validation failed!" << std::endl;
+        }
+        cleanup();
+        return stats;
+    }
+
     virtual ~DataProcessor() = default;
 
 protected:
@@ -1692,6 +3963,16 @@ protected:
     virtual bool validateData() {
         return true;  // Default implementation
     }
+
+    // Streaming hooks. transformChunk() runs concurrently on several chunks, so it
+    // must only read shared state and return everything it computes in the partial.
+    virtual void beginStream() {}
+
+    virtual std::unique_ptr<PartialResult> transformChunk(std::string_view) const {
+        throw std::logic_error("This processor does not support streaming");
+    }
+
+    virtual void mergePartial(PartialResult&) {}
 };
 
 // Concrete implementation 1
@@ -1700,6 +3981,34 @@ private:
     std::vector<std::vector<std::string>> data;
     std::vector<double> results;
 
+    // Streaming aggregates: per-row sums reduced to count/total/min/max
+    struct Aggregate : PartialResult {
+        size_t rows = 0;
+        size_t invalidCells = 0;
+        double total = 0;
+        double minRowSum = std::numeric_limits<double>::infinity();
+        double maxRowSum = -std::numeric_limits<double>::infinity();
+        std::vector<double> columnSums;
+
+        void merge(const Aggregate& other) {
+            rows += other.rows;
+            invalidCells += other.invalidCells;
+            total += other.total;
+            minRowSum = std::min(minRowSum, other.minRowSum);
+            maxRowSum = std::max(maxRowSum, other.maxRowSum);
+            if (columnSums.size() < other.columnSums.size()) {
+                columnSums.resize(other.columnSums.size(), 0.0);
+            }
+            for (size_t c = 0; c < other.columnSums.size(); ++c) {
+                columnSums[c] += other.columnSums[c];
+            }
+        }
+    };
+
+    bool streaming = false;
+    Aggregate totals;
+    double streamAverage = 0;
+
 protected:
     void loadData() override {
         std::cout << "Loading CSV data..." << std::endl;
@@ -1719,8 +4028,77 @@ protected:
         }
     }
 
+    void beginStream() override {
+        streaming = true;
+        totals = Aggregate();
+    }
+
+    // Cells are string_views into the chunk, parsed in place with from_chars
+    std::unique_ptr<PartialResult> transformChunk(std::string_view records) const override {
+        auto partial = std::make_unique<Aggregate>();
+        while (!records.empty()) {
+            size_t lineEnd = records.find('\n');
+            std::string_view line = records.substr(0, lineEnd);
+            records.remove_prefix(lineEnd == std::string_view::npos ? records.size() : lineEnd + 1);
+            if (!line.empty() && line.back() == '\r') {
+                line.remove_suffix(1);
+            }
+            if (line.empty()) {
+                continue;
+            }
+
+            double sum = 0;
+            size_t column = 0, parsed = 0;
+            const char* p = line.data();
+            const char* end = p + line.size();
+            while (true) {
+                const char* cellEnd = static_cast<const char*>(std::memchr(p, ',', static_cast<size_t>(end - p)));
+                if (!cellEnd) {
+                    cellEnd = end;
+                }
+                double value = 0;
+                auto [parsedTo, ec] = std::from_chars(p, cellEnd, value);
+                if (ec == std::errc() && parsedTo == cellEnd) {
+                    sum += value;
+                    ++parsed;
+                    if (partial->columnSums.size() <= column) {
+                        partial->columnSums.resize(column + 1, 0.0);
+                    }
+                    partial->columnSums[column] += value;
+                } else {
+                    ++partial->invalidCells;  // Header names, blanks, malformed numbers
+                }
+                ++column;
+                if (cellEnd == end) {
+                    break;
+                }
+                p = cellEnd + 1;
+            }
+            if (parsed == 0) {
+                continue;  // Header or text-only line
+            }
+            ++partial->rows;
+            partial->total += sum;
+            partial->minRowSum = std::min(partial->minRowSum, sum);
+            partial->maxRowSum = std::max(partial->maxRowSum, sum);
+        }
+        return partial;
+    }
+
+    void mergePartial(PartialResult& partial) override {
+        totals.merge(static_cast<Aggregate&>(partial));
+    }
+
+    bool validateData() override {
+        return !streaming || totals.rows > 0;
+    }
+
     void calculateResults() override {
         std::cout << "Calculating results..." << std::endl;
+        if (streaming) {
+            streamAverage = totals.total / totals.rows;
+            return;
+        }
         // Calculate average
         double total = 0;
         for (double result : results) {
@@ -1731,6 +4109,18 @@ protected:
     }
 
     void displayResults() override {
+        if (streaming) {
+            std::cout << "CSV Streaming Results:" << std::endl;
+            std::cout << "Rows: " << totals.rows << ", invalid cells: " << totals.invalidCells << std::endl;
+            std::cout << "Row sum min/avg/max: " << totals.minRowSum << " / " << streamAverage << " / "
+                      << totals.maxRowSum << std::endl;
+            std::cout << "Column sums:";
+            for (double sum : totals.columnSums) {
+                std::cout << " " << sum;
+            }
+            std::cout << std::endl;
+            return;
+        }
         std::cout << "CSV Processing Results:" << std::endl;
         for (size_t i = 0; i < results.size(); ++i) {
             if (i < results.size() - 1) {
@@ -1745,6 +4135,7 @@ protected:
         std::cout << "Cleaning up CSV resources..." << std::endl;
         data.clear();
         results.clear();
+        streaming = false;
     }
 };
 
@@ -1754,6 +4145,69 @@ private:
     std::map<std::string, double> data;
     std::vector<std::pair<std::string, double>> results;
 
+    // Streaming input is JSON Lines: one {"item": "...", "price": ...} object per line
+    struct PriceSummary : PartialResult {
+        size_t items = 0;
+        size_t skipped = 0;
+        double total = 0;
+        std::pair<std::string, double> cheapest{"", std::numeric_limits<double>::infinity()};
+        std::pair<std::string, double> priciest{"", -std::numeric_limits<double>::infinity()};
+
+        void add(std::string_view item, double price) {
+            ++items;
+            total += price;
+            if (price < cheapest.second) {
+                cheapest = {std::string(item), price};
+            }
+            if (price > priciest.second) {
+                priciest = {std::string(item), price};
+            }
+        }
+
+        void merge(const PriceSummary& other) {
+            items += other.items;
+            skipped += other.skipped;
+            total += other.total;
+            if (other.cheapest.second < cheapest.second) {
+                cheapest = other.cheapest;
+            }
+            if (other.priciest.second > priciest.second) {
+                priciest = other.priciest;
+            }
+        }
+    };
+
+    bool streaming = false;
+    PriceSummary summary;
+
+    // Value of "key" in a flat JSON object line; enough for the feed format above
+    static std::string_view fieldValue(std::string_view line, std::string_view key) {
+        size_t pos = 0;
+        while ((pos = line.find(key, pos)) != std::string_view::npos) {
+            bool quoted = pos > 0 && line[pos - 1] == '"' && pos + key.size() < line.size() &&
+                          line[pos + key.size()] == '"';
+            pos += key.size();
+            if (!quoted) {
+                continue;
+            }
+            size_t colon = line.find(':', pos);
+            if (colon == std::string_view::npos) {
+                return {};
+            }
+            size_t start = line.find_first_not_of(" \t", colon + 1);
+            if (start == std::string_view::npos) {
+                return {};
+            }
+            if (line[start] == '"') {
+                size_t close = line.find('"', start + 1);
+                return close == std::string_view::npos ? std::string_view() : line.substr(start + 1, close - start - 1);
+            }
+            size_t stop = line.find_first_of(",} \t", start);
+            return line.substr(start, stop == std::string_view::npos ? std::string_view::npos : stop - start);
+        }
+        return {};
+    }
+
 protected:
     void loadData() override {
         std::cout << "Loading JSON data..." << std::endl;
@@ -1763,6 +4217,9 @@ protected:
 
     bool validateData() override {
         std::cout << "Validating JSON data..." << std::endl;
+        if (streaming) {
+            return summary.items > 0;
+        }
         // Custom validation for JSON
         return !data.empty() && data.size() <= 10;
     }
@@ -1775,14 +4232,56 @@ protected:
         }
     }
 
+    void beginStream() override {
+        streaming = true;
+        summary = PriceSummary();
+    }
+
+    std::unique_ptr<PartialResult> transformChunk(std::string_view records) const override {
+        auto partial = std::make_unique<PriceSummary>();
+        while (!records.empty()) {
+            size_t lineEnd = records.find('\n');
+            std::string_view line = records.substr(0, lineEnd);
+            records.remove_prefix(lineEnd == std::string_view::npos ? records.size() : lineEnd + 1);
+            if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+                continue;
+            }
+            std::string_view item = fieldValue(line, "item");
+            std::string_view priceText = fieldValue(line, "price");
+            double price = 0;
+            auto [parsedTo, ec] = std::from_chars(priceText.data(), priceText.data() + priceText.size(), price);
+            if (item.empty() || ec != std::errc() || parsedTo != priceText.data() + priceText.size()) {
+                ++partial->skipped;
+                continue;
+            }
+            partial->add(item, price * 0.9);  // Same 10% discount as transformData()
+        }
+        return partial;
+    }
+
+    void mergePartial(PartialResult& partial) override {
+        summary.merge(static_cast<PriceSummary&>(partial));
+    }
+
     void calculateResults() override {
         std::cout << "Calculating results..." << std::endl;
+        if (streaming) {
+            return;  // Already reduced by mergePartial
+        }
         // Sort by price
         std::sort(results.begin(), results.end(),
                  [](const auto& a, const auto& b) { return a.second < b.second; });
     }
 
     void displayResults() override {
+        if (streaming) {
+            std::cout << "JSON Streaming Results (after 10% discount):" << std::endl;
+            std::cout << "Items: " << summary.items << ", skipped lines: " << summary.skipped
+                      << ", average price: $" << summary.total / summary.items << std::endl;
+            std::cout << "Cheapest: " << summary.cheapest.first << " $" << summary.cheapest.second
+                      << ", priciest: " << summary.priciest.first << " $" << summary.priciest.second << std::endl;
+            return;
+        }
         std::cout << "JSON Processing Results (after 10% discount):" << std::endl;
         for (const auto& [item, price] : results) {
             std::cout << item << ": $" << price << std::endl;
@@ -1793,9 +4292,67 @@ protected:
         std::cout << "Cleaning up JSON resources..." << std::endl;
         data.clear();
         results.clear();
+        streaming = false;
     }
 };
 
+void benchmark_streaming_csv() {
+    const size_t rows = 500000;
+    std::string path = (std::filesystem::temp_directory_path() / "design_patterns_stream.csv").string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "a,b,c\n";
+        for (size_t i = 0; i < rows; ++i) {
+            out << i % 1000 << "," << (i * 7) % 100 << "." << i % 10 << "," << (i % 13) * 0.5 << "\n";
+        }
+    }
+    auto elapsed_ms = [](auto start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+    };
+
+    // Eager baseline in the style of loadData/transformData: every cell becomes a std::string
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        std::ifstream in(path);
+        std::vector<std::vector<std::string>> table;
+        std::string line;
+        while (std::getline(in, line)) {
+            std::vector<std::string> cells;
+            std::stringstream ss(line);
+            std::string cell;
+            while (std::getline(ss, cell, ',')) {
+                cells.push_back(cell);
+            }
+            table.push_back(std::move(cells));
+        }
+        double total = 0;
+        for (size_t r = 1; r < table.size(); ++r) {
+            for (const auto& cell : table[r]) {
+                total += std::stod(cell);
+            }
+        }
+        std::cout << "Eager vector<vector<string>> + stod: " << elapsed_ms(start) << " ms (total " << total << ")"
+                  << std::endl;
+    }
+
+    CSVDataProcessor processor;
+    StreamOptions options;
+    options.threads = 4;
+    start = std::chrono::high_resolution_clock::now();
+    FileChunkSource file(path, 256 << 10);
+    StreamStats stats = processor.processStream(file, options);
+    std::cout << "Streaming (chunked reads): " << elapsed_ms(start) << " ms, " << stats.chunks << " chunks, at most "
+              << stats.max_in_flight << " x 256 KiB buffered" << std::endl;
+
+#if defined(__unix__) || defined(__APPLE__)
+    start = std::chrono::high_resolution_clock::now();
+    MappedFileSource mapped(path, 256 << 10);
+    stats = processor.processStream(mapped, options);
+    std::cout << "Streaming (memory-mapped): " << elapsed_ms(start) << " ms, " << stats.chunks << " chunks" << std::endl;
+#endif
+    std::remove(path.c_str());
+}
+
 void demonstrate_template_method() {
     std::cout << "=== TEMPLATE METHOD PATTERN ===" << std::endl;
 
@@ -1806,6 +4363,22 @@ void demonstrate_template_method() {
     std::cout << "\nProcessing JSON data:" << std::endl;
     JSONDataProcessor jsonProcessor;
     jsonProcessor.processData();
+
+    std::cout << "\nStreaming JSON Lines through the same pipeline:" << std::endl;
+    std::string feed =
+        "{\"item\": \"apple\", \"price\": 1.5}\n"
+        "{\"item\": \"banana\", \"price\": 0.8}\n"
+        "{\"item\": \"orange\", \"price\": 1.2}\n"
+        "{\"item\": \"mango\", \"price\": 2.75}\n"
+        "not json\n"
+        "{\"price\": 3.1, \"item\": \"papaya\"}\n";
+    StringChunkSource jsonSource(feed, 48);  // Tiny chunks so several run in parallel
+    StreamOptions options;
+    options.threads = 2;
+    jsonProcessor.processStream(jsonSource, options);
+
+    std::cout << "\nStreaming a CSV file:" << std::endl;
+    benchmark_streaming_csv();
     std::cout << std::endl;
 }
 
@@ -2,6 +2,61 @@
 #include <vector>
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Growth policy that doubles the capacity (the classic choice)
+ *
+ * A growth policy is a type with a static `grow(capacity)` function that
+ * returns the next capacity. Passing a different policy as a template
+ * argument changes how DynamicArray grows without touching the class.
+ */
+struct DoublingGrowth {
+    static size_t grow(size_t capacity) {
+        return capacity == 0 ? 1 : capacity * 2;
+    }
+};
+
+/**
+ * @brief Growth policy with a configurable factor Numerator / Denominator
+ *
+ * `FactorGrowth<3, 2>` grows by 1.5x, which wastes less memory than doubling
+ * and lets the allocator reuse previously freed blocks.
+ */
+template <size_t Numerator, size_t Denominator>
+struct FactorGrowth {
+    static_assert(Numerator > Denominator, "Growth factor must be greater than 1");
+
+    static size_t grow(size_t capacity) {
+        size_t next = capacity * Numerator / Denominator;
+        return next > capacity ? next : capacity + 1;
+    }
+};
+
+/**
+ * @brief Raw, correctly aligned storage for N objects of type T
+ *
+ * The bytes are *not* objects yet: elements are created in them with
+ * placement new and destroyed explicitly. The N == 0 specialization takes
+ * no space, so a plain DynamicArray carries no inline buffer at all.
+ */
+template <typename T, size_t N>
+struct InlineBuffer {
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    T* get() { return reinterpret_cast<T*>(bytes); }
+    const T* get() const { return reinterpret_cast<const T*>(bytes); }
+};
+
+template <typename T>
+struct InlineBuffer<T, 0> {
+    T* get() { return nullptr; }
+    const T* get() const { return nullptr; }
+};
 
 /**
  * @brief Dynamic Array implementation similar to std::vector
@@ -15,6 +70,15 @@
  * - Insert at end: Amortized O(1) - The actual time complexity of the operation is averaged over multiple operations.
  * - Insert at arbitrary position: O(n)
  * - Delete: O(n)
+ *
+ * Memory management:
+ * - Storage is allocated uninitialized, and elements are constructed only
+ *   when added, so T does not need a default constructor
+ * - Growing, inserting and removing *move* elements rather than copying them,
+ *   so a DynamicArray<std::string> never deep-copies on resize
+ * - The first InlineCapacity elements live inside the object itself (a
+ *   "small vector"), so short arrays never touch the heap
+ * - GrowthPolicy decides the next capacity (see DoublingGrowth, FactorGrowth)
  */
 
 /**
@@ -22,13 +86,15 @@
  *
  * The `typename` keyword is used in templates to specify that a type is being used. It is used instead of `class` when the type is dependent on a template parameter.
  *
- * For example, consider the following template:
- *
+ * Template parameters can also be values (`size_t InlineCapacity`) or types
+ * with a default (`typename GrowthPolicy = DoublingGrowth`), so
+ * `DynamicArray<int>` keeps working while `DynamicArray<int, 8>` gets an
+ * inline buffer of eight ints.
  */
-template <typename T>
+template <typename T, size_t InlineCapacity = 0, typename GrowthPolicy = DoublingGrowth>
 class DynamicArray {
 private:
-    T* data;           // Pointer to dynamically allocated array
+    T* data;           // Points to the inline buffer or to heap storage
     size_t capacity;   // Total allocated capacity
 
     /**
@@ -40,56 +106,264 @@ private:
      */
     size_t size;       // Current number of elements
 
+    InlineBuffer<T, InlineCapacity> inline_storage;  // Small-buffer storage
+
+    bool is_inline() const {
+        return InlineCapacity > 0 && data == inline_storage.get();
+    }
+
+    /**
+     * @brief Allocate raw storage for n elements (no constructors run)
+     */
+    T* allocate(size_t n) {
+        if (n <= InlineCapacity) {
+            return inline_storage.get();
+        }
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T* ptr, size_t n) {
+        if (ptr != nullptr && ptr != inline_storage.get()) {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+    }
+
+    static void destroy_range(T* ptr, size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            ptr[i].~T();
+        }
+    }
+
+    void destroy_all() {
+        destroy_range(data, size);
+    }
+
+    /**
+     * @brief Move-construct `count` elements from src into raw storage at dst
+     *
+     * `std::move_if_noexcept` falls back to copying for types whose move
+     * constructor may throw. If a constructor throws, the elements already
+     * built at dst are destroyed and src is untouched. The sources are not
+     * destroyed here: callers do that once every relocation has succeeded,
+     * so a failed resize leaves the array unchanged.
+     */
+    static void relocate(T* src, size_t count, T* dst) {
+        size_t built = 0;
+        try {
+            for (; built < count; ++built) {
+                ::new (static_cast<void*>(dst + built)) T(std::move_if_noexcept(src[built]));
+            }
+        } catch (...) {
+            destroy_range(dst, built);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Capacity to grow to so that at least `required` elements fit
+     */
+    size_t grown_capacity(size_t required) const {
+        size_t new_capacity = capacity;
+        while (new_capacity < required) {
+            new_capacity = GrowthPolicy::grow(new_capacity);
+        }
+        return new_capacity;
+    }
+
     /**
      * @brief Resize the internal array to new capacity
      * @param new_capacity The new capacity to resize to
      */
     void resize(size_t new_capacity) {
-        // Allocate memory for the new array
-        // The `new` keyword is used to dynamically allocate memory on the heap. It returns a pointer to the first element of the allocated memory.
-        // `T*` is a pointer to a type T. In this case, `T` is the template parameter of the `DynamicArray` class, which represents the type of elements in the array.
-        // `new T[new_capacity]` creates an array of `new_capacity` elements of type `T` and returns a pointer to the first element of the array.
-        // The allocated memory is not automatically initialized, so it contains unpredictable values.
-        // The allocated memory is automatically deallocated when it is no longer needed by the program, which is typically done using the `delete` keyword.
-        T* new_data = new T[new_capacity];
-
-        // Copy existing elements to new array
-        for (size_t i = 0; i < size; ++i) {
-            new_data[i] = data[i];
+        // Allocate raw memory for the new array
+        // Unlike `new T[new_capacity]`, which default-constructs every slot, this only
+        // reserves the bytes. Elements are created with placement new (`::new (ptr) T(...)`)
+        // and destroyed with an explicit destructor call (`ptr->~T()`).
+        T* new_data = allocate(new_capacity);
+        if (new_data == data) {
+            capacity = new_capacity;
+            return;
+        }
+
+        // Move existing elements to the new array
+        try {
+            relocate(data, size, new_data);
+        } catch (...) {
+            deallocate(new_data, new_capacity);
+            throw;
         }
+        destroy_all();
 
         // Free old memory and update pointers
-        delete[] data;
+        deallocate(data, capacity);
         data = new_data;
         capacity = new_capacity;
     }
 
+    /**
+     * @brief Open a gap at `index` and construct a new element in it
+     */
+    template <typename... Args>
+    void insert_at(size_t index, Args&&... args) {
+        if (index > size) {
+            throw std::out_of_range("Index out of bounds");
+        }
+
+        if (size >= capacity) {
+            // Build the new buffer in one pass: prefix, new element, suffix
+            size_t new_capacity = grown_capacity(size + 1);
+            T* new_data = allocate(new_capacity);
+            try {
+                ::new (static_cast<void*>(new_data + index)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            try {
+                relocate(data, index, new_data);
+                try {
+                    relocate(data + index, size - index, new_data + index + 1);
+                } catch (...) {
+                    destroy_range(new_data, index);
+                    throw;
+                }
+            } catch (...) {
+                new_data[index].~T();
+                deallocate(new_data, new_capacity);
+                throw;
+            }
+            destroy_all();
+            deallocate(data, capacity);
+            data = new_data;
+            capacity = new_capacity;
+            size++;
+            return;
+        }
+
+        if (index == size) {
+            ::new (static_cast<void*>(data + size)) T(std::forward<Args>(args)...);
+            size++;
+            return;
+        }
+
+        // Build the value first: args may refer to an element that is about to move
+        T value(std::forward<Args>(args)...);
+
+        // Shift elements to the right by moving them
+        ::new (static_cast<void*>(data + size)) T(std::move(data[size - 1]));
+        std::move_backward(data + index, data + size - 1, data + size);
+        data[index] = std::move(value);
+        size++;
+    }
+
+    /**
+     * @brief Copy-construct other's elements into the (empty) buffer
+     *
+     * If a copy throws, the copies already made are destroyed and the array
+     * stays empty; the buffer itself is left to the caller.
+     */
+    void copy_from(const DynamicArray& other) {
+        size_t constructed = 0;
+        try {
+            for (; constructed < other.size; ++constructed) {
+                ::new (static_cast<void*>(data + constructed)) T(other.data[constructed]);
+            }
+        } catch (...) {
+            destroy_range(data, constructed);
+            throw;
+        }
+        size = other.size;
+    }
+
+    void move_from(DynamicArray& other) {
+        if (other.is_inline()) {
+            // Inline elements cannot be stolen, so move them one by one
+            data = allocate(other.size);
+            capacity = data == inline_storage.get() ? InlineCapacity : other.size;
+            try {
+                relocate(other.data, other.size, data);
+            } catch (...) {
+                deallocate(data, capacity);
+                data = inline_storage.get();
+                capacity = InlineCapacity;
+                throw;
+            }
+            destroy_range(other.data, other.size);
+            size = other.size;
+            other.size = 0;
+        } else {
+            data = other.data;
+            capacity = other.capacity;
+            size = other.size;
+            other.data = other.inline_storage.get();
+            other.capacity = InlineCapacity;
+            other.size = 0;
+        }
+    }
+
 public:
     /**
      * @brief Constructor with initial capacity
      * @param initial_capacity Starting capacity of the array
      */
-    DynamicArray(size_t initial_capacity = 10)
-        : capacity(initial_capacity), size(0) {
-        data = new T[capacity];
+    DynamicArray(size_t initial_capacity = InlineCapacity > 0 ? InlineCapacity : 10)
+        : capacity(initial_capacity < InlineCapacity ? InlineCapacity : initial_capacity), size(0) {
+        data = allocate(capacity);
     }
 
     /**
      * @brief Copy constructor
      */
     DynamicArray(const DynamicArray& other)
-        : capacity(other.capacity), size(other.size) {
-        data = new T[capacity];
-        for (size_t i = 0; i < size; ++i) {
-            data[i] = other.data[i];
+        : capacity(other.size < InlineCapacity ? InlineCapacity : other.size), size(0) {
+        data = allocate(capacity);
+        try {
+            copy_from(other);
+        } catch (...) {
+            deallocate(data, capacity);  // ~DynamicArray never runs for a throwing constructor
+            throw;
+        }
+    }
+
+    /**
+     * @brief Move constructor - steals the heap buffer instead of copying
+     */
+    DynamicArray(DynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : data(nullptr), capacity(0), size(0) {
+        move_from(other);
+    }
+
+    /**
+     * @brief Copy assignment operator
+     */
+    DynamicArray& operator=(const DynamicArray& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size);
+            copy_from(other);
         }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment operator
+     */
+    DynamicArray& operator=(DynamicArray&& other) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &other) {
+            destroy_all();
+            deallocate(data, capacity);
+            size = 0;
+            move_from(other);
+        }
+        return *this;
     }
 
     /**
      * @brief Destructor - clean up allocated memory
      */
     ~DynamicArray() {
-        delete[] data;
+        destroy_all();
+        deallocate(data, capacity);
     }
 
     /**
@@ -97,10 +371,26 @@ public:
      * @param value Element to add
      */
     void push_back(const T& value) {
-        if (size >= capacity) {
-            resize(capacity * 2);  // Double the capacity
-        }
-        data[size++] = value;
+        emplace_back(value);
+    }
+
+    /**
+     * @brief Add element to the end of array by moving it in
+     * @param value Element to move from
+     */
+    void push_back(T&& value) {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief Construct an element in place at the end of array
+     * @param args Arguments forwarded to T's constructor
+     * @return Reference to the new element
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        insert_at(size, std::forward<Args>(args)...);
+        return data[size - 1];
     }
 
     /**
@@ -110,7 +400,7 @@ public:
         if (size == 0) {
             throw std::out_of_range("Array is empty");
         }
-        size--;
+        data[--size].~T();
     }
 
     /**
@@ -119,21 +409,22 @@ public:
      * @param value Element to insert
      */
     void insert(size_t index, const T& value) {
-        if (index > size) {
-            throw std::out_of_range("Index out of bounds");
-        }
-
-        if (size >= capacity) {
-            resize(capacity * 2);
-        }
+        insert_at(index, value);
+    }
 
-        // Shift elements to the right
-        for (size_t i = size; i > index; --i) {
-            data[i] = data[i - 1];
-        }
+    /**
+     * @brief Insert element at specific position by moving it in
+     */
+    void insert(size_t index, T&& value) {
+        insert_at(index, std::move(value));
+    }
 
-        data[index] = value;
-        size++;
+    /**
+     * @brief Construct an element in place at specific position
+     */
+    template <typename... Args>
+    void emplace(size_t index, Args&&... args) {
+        insert_at(index, std::forward<Args>(args)...);
     }
 
     /**
@@ -145,12 +436,9 @@ public:
             throw std::out_of_range("Index out of bounds");
         }
 
-        // Shift elements to the left
-        for (size_t i = index; i < size - 1; ++i) {
-            data[i] = data[i + 1];
-        }
-
-        size--;
+        // Shift elements to the left by moving them
+        std::move(data + index + 1, data + size, data + index);
+        data[--size].~T();
     }
 
     /**
@@ -209,10 +497,38 @@ public:
         return size == 0;
     }
 
+    /**
+     * @brief Check if elements are stored in the inline buffer
+     */
+    bool uses_inline_storage() const {
+        return is_inline();
+    }
+
+    /**
+     * @brief Make room for at least new_capacity elements
+     * @param new_capacity Minimum capacity after the call
+     */
+    void reserve(size_t new_capacity) {
+        if (new_capacity > capacity) {
+            resize(new_capacity);
+        }
+    }
+
+    /**
+     * @brief Release unused capacity (moves back to inline storage if it fits)
+     */
+    void shrink_to_fit() {
+        size_t target = size < InlineCapacity ? InlineCapacity : size;
+        if (target < capacity && !is_inline()) {
+            resize(target);
+        }
+    }
+
     /**
      * @brief Clear all elements
      */
     void clear() {
+        destroy_all();
         size = 0;
     }
 
@@ -243,4 +559,13 @@ public:
         }
         std::cout << "]" << std::endl;
     }
-};
\ No newline at end of file
+};
+
+/**
+ * @brief DynamicArray whose first N elements never touch the heap
+ *
+ * Usage: `SmallVector<std::string, 4> tags;` stores up to four strings
+ * inside the object and switches to heap storage on the fifth.
+ */
+template <typename T, size_t N, typename GrowthPolicy = DoublingGrowth>
+using SmallVector = DynamicArray<T, N, GrowthPolicy>;
@@ -1,6 +1,154 @@
 #pragma once
 #include <iostream>
 #include <stdexcept>
+#include <chrono>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Node Allocators for Linked Containers
+ *
+ * Every linked container in this collection (SinglyLinkedList,
+ * DoublyLinkedList, LinkedListStack, LinkedListQueue) takes a node
+ * allocator as its last template parameter:
+ *
+ *     SinglyLinkedList<int>                 // one new/delete per node
+ *     SinglyLinkedList<int, PoolAllocator>  // nodes carved from slabs
+ *
+ * A node allocator is a class template over the container's Node type with:
+ * - create(args...)  - construct a node and return a pointer to it
+ * - destroy(node)    - destroy a node and give its memory back
+ * - release_all()    - drop every node at once without running destructors
+ * - can_release_all  - whether release_all() actually frees anything
+ */
+
+/**
+ * @brief Node allocator that calls new/delete for every node
+ */
+template <typename Node>
+class NewDeleteAllocator {
+public:
+    static constexpr bool can_release_all = false;
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        return new Node(std::forward<Args>(args)...);
+    }
+
+    void destroy(Node* node) {
+        delete node;
+    }
+
+    void release_all() {}
+};
+
+/**
+ * @brief Free-list pool allocator that hands out nodes from contiguous slabs
+ *
+ * Nodes are bump-allocated from slabs that double in size, so consecutive
+ * nodes sit next to each other in memory. destroy() pushes the node onto a
+ * free list, and the next create() reuses it, so steady-state push/pop
+ * churn performs no heap allocation at all. release_all() just rewinds the
+ * bump pointer to the first slab: O(1), with the slabs kept for reuse.
+ *
+ * Memory is returned to the heap only when the allocator is destroyed.
+ * Each container owns its own pool, so the pool needs no locking.
+ */
+template <typename Node>
+class PoolAllocator {
+private:
+    union Slot {
+        Slot* next;                                      // Link while on the free list
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Slab {
+        std::unique_ptr<Slot[]> slots;
+        size_t capacity;
+    };
+
+    std::vector<Slab> slabs;   // All slabs ever allocated
+    size_t current_slab;       // Slab being bump-allocated from
+    size_t used_in_slab;       // Slots handed out from the current slab
+    Slot* free_list;           // Recycled slots
+
+    static constexpr size_t first_slab_size = 64;
+    static constexpr size_t max_slab_size = 64 * 1024;
+
+    Slot* next_slot() {
+        if (free_list != nullptr) {
+            Slot* slot = free_list;
+            free_list = slot->next;
+            return slot;
+        }
+
+        if (current_slab < slabs.size() && used_in_slab == slabs[current_slab].capacity) {
+            current_slab++;
+            used_in_slab = 0;
+        }
+
+        if (current_slab == slabs.size()) {
+            size_t capacity = slabs.empty() ? first_slab_size : slabs.back().capacity * 2;
+            if (capacity > max_slab_size) {
+                capacity = max_slab_size;
+            }
+            slabs.push_back(Slab{std::unique_ptr<Slot[]>(new Slot[capacity]), capacity});
+        }
+
+        return &slabs[current_slab].slots[used_in_slab++];
+    }
+
+public:
+    static constexpr bool can_release_all = true;
+
+    PoolAllocator() : current_slab(0), used_in_slab(0), free_list(nullptr) {}
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    template <typename... Args>
+    Node* create(Args&&... args) {
+        Slot* slot = next_slot();
+        try {
+            return ::new (static_cast<void*>(slot->storage)) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next = free_list;
+            free_list = slot;
+            throw;
+        }
+    }
+
+    void destroy(Node* node) {
+        node->~Node();
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->next = free_list;
+        free_list = slot;
+    }
+
+    /**
+     * @brief Forget every node in O(1); only valid when no node needs its
+     *        destructor run (the containers check this before calling)
+     */
+    void release_all() {
+        current_slab = 0;
+        used_in_slab = 0;
+        free_list = nullptr;
+    }
+
+    /**
+     * @brief Total number of node slots reserved across all slabs
+     */
+    size_t reserved_nodes() const {
+        size_t total = 0;
+        for (const auto& slab : slabs) {
+            total += slab.capacity;
+        }
+        return total;
+    }
+};
 
 /**
  * @brief Singly Linked List Implementation
@@ -15,7 +163,7 @@
  * - Delete: O(n) (need to find the node first)
  * - Search: O(n)
  */
-template <typename T>
+template <typename T, template <typename> class NodeAllocator = NewDeleteAllocator>
 class SinglyLinkedList {
 private:
     struct Node {
@@ -28,6 +176,7 @@ private:
     Node* head;     // Pointer to first node
     Node* tail;     // Pointer to last node
     size_t count;   // Number of nodes in list
+    NodeAllocator<Node> allocator;  // Source of node memory
 
 public:
     /**
@@ -58,7 +207,7 @@ public:
      * @param value Element to add
      */
     void push_front(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
         new_node->next = head;
         head = new_node;
 
@@ -74,7 +223,7 @@ public:
      * @param value Element to add
      */
     void push_back(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
 
         if (tail == nullptr) {
             head = tail = new_node;
@@ -101,7 +250,7 @@ public:
             tail = nullptr;
         }
 
-        delete temp;
+        allocator.destroy(temp);
         count--;
     }
 
@@ -114,7 +263,7 @@ public:
         }
 
         if (head == tail) {
-            delete head;
+            allocator.destroy(head);
             head = tail = nullptr;
         } else {
             Node* current = head;
@@ -122,7 +271,7 @@ public:
                 current = current->next;
             }
 
-            delete tail;
+            allocator.destroy(tail);
             tail = current;
             tail->next = nullptr;
         }
@@ -150,7 +299,7 @@ public:
                 current = current->next;
             }
 
-            Node* new_node = new Node(value);
+            Node* new_node = allocator.create(value);
             new_node->next = current->next;
             current->next = new_node;
             count++;
@@ -178,7 +327,7 @@ public:
 
             Node* temp = current->next;
             current->next = temp->next;
-            delete temp;
+            allocator.destroy(temp);
             count--;
         }
     }
@@ -241,10 +390,14 @@ public:
      * @brief Clear all elements
      */
     void clear() {
+        if (NodeAllocator<Node>::can_release_all && std::is_trivially_destructible<T>::value) {
+            allocator.release_all();  // O(1): no destructors to run
+            head = nullptr;
+        }
         while (head != nullptr) {
             Node* temp = head;
             head = head->next;
-            delete temp;
+            allocator.destroy(temp);
         }
         tail = nullptr;
         count = 0;
@@ -279,7 +432,7 @@ public:
  * - Insert at arbitrary position: O(n)
  * - Delete: O(n) (but easier than singly linked)
  */
-template <typename T>
+template <typename T, template <typename> class NodeAllocator = NewDeleteAllocator>
 class DoublyLinkedList {
 private:
     struct Node {
@@ -293,6 +446,7 @@ private:
     Node* head;
     Node* tail;
     size_t count;
+    NodeAllocator<Node> allocator;
 
 public:
     /**
@@ -311,7 +465,7 @@ public:
      * @brief Add element to the beginning
      */
     void push_front(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
 
         if (head == nullptr) {
             head = tail = new_node;
@@ -328,7 +482,7 @@ public:
      * @brief Add element to the end
      */
     void push_back(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
 
         if (tail == nullptr) {
             head = tail = new_node;
@@ -358,7 +512,7 @@ public:
             tail = nullptr;
         }
 
-        delete temp;
+        allocator.destroy(temp);
         count--;
     }
 
@@ -379,7 +533,7 @@ public:
             head = nullptr;
         }
 
-        delete temp;
+        allocator.destroy(temp);
         count--;
     }
 
@@ -417,5 +571,488 @@ public:
 
     size_t size() const { return count; }
     bool is_empty() const { return head == nullptr; }
-    void clear() { while (!is_empty()) pop_front(); }
-};
\ No newline at end of file
+    void clear() {
+        if (NodeAllocator<Node>::can_release_all && std::is_trivially_destructible<T>::value) {
+            allocator.release_all();
+            head = tail = nullptr;
+            count = 0;
+            return;
+        }
+        while (!is_empty()) pop_front();
+    }
+};
+
+/**
+ * @brief Unrolled Linked List Implementation
+ *
+ * A doubly linked list of small fixed-size blocks, each holding several
+ * elements in a contiguous array. With the default BlockBytes of 64 a block
+ * fits in one cache line (10 ints per block), so walking the list costs one
+ * cache miss per block instead of one per element.
+ *
+ * Invariants:
+ * - Every block except the last holds at least half its capacity, so
+ *   memory overhead stays below 2x and traversal touches at most about
+ *   2n / capacity blocks
+ * - A full block is split into two half-full blocks before an insert
+ * - A block that drops below half capacity borrows from or merges with
+ *   its successor
+ *
+ * Time Complexity (B = elements per block):
+ * - Access by index: O(n / B)
+ * - Insert/Delete at known block: O(B)
+ * - Insert/Delete at beginning or end: O(1) (amortized)
+ * - Search: O(n), but with sequential memory access inside each block
+ *
+ * The API matches SinglyLinkedList, plus at()/operator[] for indexed access.
+ */
+template <typename T, size_t BlockBytes = 64,
+          template <typename> class NodeAllocator = NewDeleteAllocator>
+class UnrolledLinkedList {
+private:
+    struct BlockHeader {
+        void* next;
+        void* prev;
+        size_t count;
+    };
+
+public:
+    /**
+     * @brief Elements per block: as many as fit in BlockBytes, at least 2
+     */
+    static constexpr size_t block_capacity =
+        (BlockBytes > sizeof(BlockHeader) + 2 * sizeof(T))
+            ? (BlockBytes - sizeof(BlockHeader)) / sizeof(T)
+            : 2;
+
+private:
+    struct Block {
+        Block* next;
+        Block* prev;
+        size_t count;
+        alignas(T) unsigned char storage[block_capacity * sizeof(T)];
+
+        Block() : next(nullptr), prev(nullptr), count(0) {}
+
+        ~Block() {
+            for (size_t i = 0; i < count; ++i) {
+                item(i).~T();
+            }
+        }
+
+        T& item(size_t i) { return reinterpret_cast<T*>(storage)[i]; }
+        const T& item(size_t i) const { return reinterpret_cast<const T*>(storage)[i]; }
+
+        /**
+         * @brief Construct a new element at offset, shifting later ones right
+         */
+        template <typename U>
+        void insert_at(size_t offset, U&& value) {
+            if (offset == count) {
+                ::new (static_cast<void*>(&item(count))) T(std::forward<U>(value));
+            } else {
+                T temp(std::forward<U>(value));  // value may alias an element
+                ::new (static_cast<void*>(&item(count))) T(std::move(item(count - 1)));
+                for (size_t i = count - 1; i > offset; --i) {
+                    item(i) = std::move(item(i - 1));
+                }
+                item(offset) = std::move(temp);
+            }
+            count++;
+        }
+
+        /**
+         * @brief Destroy the element at offset, shifting later ones left
+         */
+        void erase_at(size_t offset) {
+            for (size_t i = offset; i + 1 < count; ++i) {
+                item(i) = std::move(item(i + 1));
+            }
+            item(--count).~T();
+        }
+
+        /**
+         * @brief Move elements [from, count) to the end of other
+         */
+        void move_tail_to(size_t from, Block* other) {
+            for (size_t i = from; i < count; ++i) {
+                ::new (static_cast<void*>(&other->item(other->count++))) T(std::move(item(i)));
+                item(i).~T();
+            }
+            count = from;
+        }
+    };
+
+    Block* head;     // First block
+    Block* tail;     // Last block
+    size_t count;    // Total number of elements
+    NodeAllocator<Block> allocator;  // Source of block memory
+
+    /**
+     * @brief Create an empty block and link it after `after` (nullptr = front)
+     */
+    Block* link_new_block(Block* after) {
+        Block* block = allocator.create();
+        block->prev = after;
+        block->next = after != nullptr ? after->next : head;
+        if (block->next != nullptr) {
+            block->next->prev = block;
+        } else {
+            tail = block;
+        }
+        if (after != nullptr) {
+            after->next = block;
+        } else {
+            head = block;
+        }
+        return block;
+    }
+
+    void unlink_block(Block* block) {
+        if (block->prev != nullptr) {
+            block->prev->next = block->next;
+        } else {
+            head = block->next;
+        }
+        if (block->next != nullptr) {
+            block->next->prev = block->prev;
+        } else {
+            tail = block->prev;
+        }
+        allocator.destroy(block);
+    }
+
+    /**
+     * @brief Find the block holding element `index` (walking from the nearer end)
+     * @param index Element index, may equal count for an insert at the end
+     * @param offset Output: index of the element inside the block
+     */
+    Block* locate(size_t index, size_t& offset) const {
+        if (index >= count / 2) {
+            size_t remaining = count;
+            Block* block = tail;
+            while (block->prev != nullptr && remaining - block->count > index) {
+                remaining -= block->count;
+                block = block->prev;
+            }
+            offset = index - (remaining - block->count);
+            return block;
+        }
+
+        Block* block = head;
+        while (index >= block->count) {
+            index -= block->count;
+            block = block->next;
+        }
+        offset = index;
+        return block;
+    }
+
+    /**
+     * @brief Split a full block in half, returning the new second half
+     */
+    Block* split(Block* block) {
+        Block* upper = link_new_block(block);
+        block->move_tail_to(block->count / 2, upper);
+        return upper;
+    }
+
+    /**
+     * @brief Restore the half-full invariant after an erase from block
+     */
+    void rebalance(Block* block) {
+        if (block->count == 0) {
+            unlink_block(block);
+            return;
+        }
+
+        Block* next = block->next;
+        if (next == nullptr || block->count >= block_capacity / 2) {
+            return;
+        }
+
+        if (block->count + next->count <= block_capacity) {
+            // Merge the successor into this block
+            next->move_tail_to(0, block);
+            unlink_block(next);
+        } else {
+            // Borrow the successor's first element
+            ::new (static_cast<void*>(&block->item(block->count++))) T(std::move(next->item(0)));
+            next->erase_at(0);
+        }
+    }
+
+    template <typename U>
+    void insert_value(size_t index, U&& value) {
+        if (index > count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+
+        if (head == nullptr) {
+            link_new_block(nullptr);
+        }
+
+        size_t offset;
+        Block* block = locate(index, offset);
+        if (block->count == block_capacity) {
+            if (offset == block_capacity) {
+                // Appending past a full tail: start a fresh last block
+                block = link_new_block(block);
+                offset = 0;
+            } else {
+                Block* upper = split(block);
+                if (offset > block->count) {
+                    offset -= block->count;
+                    block = upper;
+                }
+            }
+        }
+
+        block->insert_at(offset, std::forward<U>(value));
+        count++;
+    }
+
+public:
+    /**
+     * @brief Constructor - initialize empty list
+     */
+    UnrolledLinkedList() : head(nullptr), tail(nullptr), count(0) {}
+
+    /**
+     * @brief Copy constructor
+     */
+    UnrolledLinkedList(const UnrolledLinkedList& other) : head(nullptr), tail(nullptr), count(0) {
+        for (Block* block = other.head; block != nullptr; block = block->next) {
+            for (size_t i = 0; i < block->count; ++i) {
+                push_back(block->item(i));
+            }
+        }
+    }
+
+    /**
+     * @brief Destructor - free all allocated memory
+     */
+    ~UnrolledLinkedList() {
+        clear();
+    }
+
+    void push_front(const T& value) { insert_value(0, value); }
+    void push_front(T&& value) { insert_value(0, std::move(value)); }
+    void push_back(const T& value) { insert_value(count, value); }
+    void push_back(T&& value) { insert_value(count, std::move(value)); }
+
+    /**
+     * @brief Insert element at specific position
+     * @param index Position to insert at (0-based)
+     * @param value Element to insert
+     */
+    void insert(size_t index, const T& value) {
+        insert_value(index, value);
+    }
+
+    /**
+     * @brief Remove first element
+     */
+    void pop_front() {
+        if (head == nullptr) {
+            throw std::out_of_range("List is empty");
+        }
+        head->erase_at(0);
+        count--;
+        rebalance(head);
+    }
+
+    /**
+     * @brief Remove last element - O(1), unlike SinglyLinkedList::pop_back
+     */
+    void pop_back() {
+        if (tail == nullptr) {
+            throw std::out_of_range("List is empty");
+        }
+        tail->erase_at(tail->count - 1);
+        count--;
+        if (tail->count == 0) {
+            unlink_block(tail);
+        }
+    }
+
+    /**
+     * @brief Remove element at specific position
+     * @param index Position to remove from (0-based)
+     */
+    void remove(size_t index) {
+        if (index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+
+        size_t offset;
+        Block* block = locate(index, offset);
+        block->erase_at(offset);
+        count--;
+        rebalance(block);
+    }
+
+    /**
+     * @brief Get element at specific position
+     */
+    T& at(size_t index) {
+        if (index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        size_t offset;
+        return locate(index, offset)->item(offset);
+    }
+
+    const T& at(size_t index) const {
+        if (index >= count) {
+            throw std::out_of_range("Index out of bounds");
+        }
+        size_t offset;
+        return locate(index, offset)->item(offset);
+    }
+
+    T& operator[](size_t index) {
+        size_t offset;
+        return locate(index, offset)->item(offset);
+    }
+
+    const T& operator[](size_t index) const {
+        size_t offset;
+        return locate(index, offset)->item(offset);
+    }
+
+    /**
+     * @brief Get first element
+     */
+    T& front() {
+        if (head == nullptr) {
+            throw std::out_of_range("List is empty");
+        }
+        return head->item(0);
+    }
+
+    /**
+     * @brief Get last element
+     */
+    T& back() {
+        if (tail == nullptr) {
+            throw std::out_of_range("List is empty");
+        }
+        return tail->item(tail->count - 1);
+    }
+
+    bool is_empty() const { return count == 0; }
+    size_t size() const { return count; }
+
+    /**
+     * @brief Search for value in list
+     * @param value Value to search for
+     * @return Index of first occurrence, or count if not found
+     */
+    size_t find(const T& value) const {
+        size_t base = 0;
+        for (Block* block = head; block != nullptr; block = block->next) {
+            for (size_t i = 0; i < block->count; ++i) {
+                if (block->item(i) == value) {
+                    return base + i;
+                }
+            }
+            base += block->count;
+        }
+        return count;  // Not found
+    }
+
+    /**
+     * @brief Clear all elements
+     */
+    void clear() {
+        if (NodeAllocator<Block>::can_release_all && std::is_trivially_destructible<T>::value) {
+            allocator.release_all();
+            head = nullptr;
+        }
+        while (head != nullptr) {
+            Block* next = head->next;
+            allocator.destroy(head);
+            head = next;
+        }
+        tail = nullptr;
+        count = 0;
+    }
+
+    /**
+     * @brief Print list elements (for debugging); | marks block boundaries
+     */
+    void print() const {
+        std::cout << "[";
+        for (Block* block = head; block != nullptr; block = block->next) {
+            for (size_t i = 0; i < block->count; ++i) {
+                std::cout << block->item(i);
+                if (i + 1 < block->count) {
+                    std::cout << ", ";
+                }
+            }
+            if (block->next != nullptr) {
+                std::cout << " | ";
+            }
+        }
+        std::cout << "]" << std::endl;
+    }
+};
+
+/**
+ * @brief Performance comparison of SinglyLinkedList and UnrolledLinkedList
+ *
+ * Builds both lists with the same 200,000 ints, then times a full find()
+ * scan for a missing value and 2,000 insert/remove pairs at random indices.
+ */
+void compare_unrolled_list_traversal() {
+    const int n = 200000;
+    SinglyLinkedList<int> plain;
+    UnrolledLinkedList<int> unrolled;
+    for (int i = 0; i < n; ++i) {
+        plain.push_back(i);
+        unrolled.push_back(i);
+    }
+
+    std::cout << "\n=== Linked List Traversal (" << n << " elements) ===" << std::endl;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t found1 = plain.find(-1);
+    auto end = std::chrono::high_resolution_clock::now();
+    auto time1 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    size_t found2 = unrolled.find(-1);
+    end = std::chrono::high_resolution_clock::now();
+    auto time2 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    // SinglyLinkedList has no indexed read, so time insert + remove at a random index
+    unsigned int seed = 42;
+    long long sum1 = 0, sum2 = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < 2000; ++q) {
+        seed = seed * 1103515245 + 12345;
+        size_t index = (seed >> 8) % n;
+        plain.insert(index, -1);
+        plain.remove(index);
+        sum1 += static_cast<long long>(index);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto time3 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    seed = 42;
+    start = std::chrono::high_resolution_clock::now();
+    for (int q = 0; q < 2000; ++q) {
+        seed = seed * 1103515245 + 12345;
+        size_t index = (seed >> 8) % n;
+        unrolled.insert(index, -1);
+        unrolled.remove(index);
+        sum2 += unrolled[index];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto time4 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "find (miss)        singly: " << time1.count() << " μs, unrolled: " << time2.count() << " μs" << std::endl;
+    std::cout << "insert+remove(idx) singly: " << time3.count() << " μs, unrolled: " << time4.count() << " μs" << std::endl;
+    std::cout << "(" << found1 << " " << found2 << " " << sum1 << " " << sum2 << ")" << std::endl;
+}
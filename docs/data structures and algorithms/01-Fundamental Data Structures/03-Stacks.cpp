@@ -1,6 +1,13 @@
 #pragma once
 #include <vector>
 #include <stdexcept>
+#include <cctype>
+#include <charconv>
+#include <limits>
+#include <string>
+#include <string_view>
+#include "01-Arrays.cpp"        // SmallVector
+#include "02-Linked Lists.cpp"  // NewDeleteAllocator, PoolAllocator
 
 /**
  * @brief Stack Implementation using Dynamic Array
@@ -114,9 +121,10 @@ public:
  * @brief Stack Implementation using Linked List
  *
  * This implementation demonstrates how to build a stack using a linked list
- * as the underlying data structure.
+ * as the underlying data structure. Use `LinkedListStack<T, PoolAllocator>`
+ * to recycle nodes instead of calling new/delete on every push/pop.
  */
-template <typename T>
+template <typename T, template <typename> class NodeAllocator = NewDeleteAllocator>
 class LinkedListStack {
 private:
     struct Node {
@@ -127,6 +135,7 @@ private:
 
     Node* top_node;  // Pointer to top element
     size_t count;    // Number of elements
+    NodeAllocator<Node> allocator;  // Source of node memory
 
 public:
     /**
@@ -145,7 +154,7 @@ public:
      * @brief Add element to top of stack
      */
     void push(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
         new_node->next = top_node;
         top_node = new_node;
         count++;
@@ -160,9 +169,9 @@ public:
         }
 
         Node* temp = top_node;
-        T value = temp->data;
+        T value = std::move(temp->data);
         top_node = top_node->next;
-        delete temp;
+        allocator.destroy(temp);
         count--;
         return value;
     }
@@ -181,9 +190,16 @@ public:
     size_t size() const { return count; }
 
     void clear() {
-        while (!is_empty()) {
-            pop();
+        if (NodeAllocator<Node>::can_release_all && std::is_trivially_destructible<T>::value) {
+            allocator.release_all();
+            top_node = nullptr;
+        }
+        while (top_node != nullptr) {
+            Node* temp = top_node;
+            top_node = top_node->next;
+            allocator.destroy(temp);
         }
+        count = 0;
     }
 
     void print() const {
@@ -202,6 +218,100 @@ public:
     }
 };
 
+/**
+ * @brief Stack with Inline Storage
+ *
+ * Same interface as Stack<T>, but the first N elements live inside the
+ * object (it is built on SmallVector<T, N> from 01-Arrays.cpp). A stack
+ * that never grows beyond N elements never touches the heap; a deeper one
+ * spills to heap storage transparently. clear() keeps whatever storage was
+ * acquired, so a stack reused across many inputs stops allocating once it
+ * has seen the deepest one.
+ *
+ * Time Complexity:
+ * - Push: Amortized O(1), O(1) with no allocation while size <= N
+ * - Pop: O(1)
+ * - Peek/Top: O(1)
+ */
+template <typename T, size_t N = 64>
+class InlineStack {
+private:
+    SmallVector<T, N> data;  // Inline buffer of N elements, heap beyond that
+
+public:
+    /**
+     * @brief Constructor - initialize empty stack
+     */
+    InlineStack() {}
+
+    /**
+     * @brief Add element to top of stack
+     */
+    void push(const T& value) {
+        data.push_back(value);
+    }
+
+    void push(T&& value) {
+        data.push_back(std::move(value));
+    }
+
+    /**
+     * @brief Remove and return top element
+     */
+    T pop() {
+        if (is_empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+
+        T top_value = std::move(data[data.get_size() - 1]);
+        data.pop_back();
+        return top_value;
+    }
+
+    /**
+     * @brief Get top element without removing it
+     */
+    const T& top() const {
+        if (is_empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+        return data[data.get_size() - 1];
+    }
+
+    T& top() {
+        if (is_empty()) {
+            throw std::out_of_range("Stack is empty");
+        }
+        return data[data.get_size() - 1];
+    }
+
+    bool is_empty() const { return data.is_empty(); }
+    size_t size() const { return data.get_size(); }
+
+    /**
+     * @brief Check whether the stack has outgrown its inline buffer
+     */
+    bool spilled() const { return !data.uses_inline_storage(); }
+
+    /**
+     * @brief Clear all elements (storage is kept for reuse)
+     */
+    void clear() {
+        data.clear();
+    }
+
+    void print() const {
+        std::cout << "Stack (top -> bottom): [";
+        for (size_t i = data.get_size(); i > 0; --i) {
+            std::cout << data[i - 1];
+            if (i > 1) {
+                std::cout << ", ";
+            }
+        }
+        std::cout << "]" << std::endl;
+    }
+};
+
 /**
  * @brief Stack Applications and Examples
  */
@@ -209,9 +319,73 @@ public:
 /**
  * @brief Check if parentheses are balanced
  * @param expression String containing parentheses
+ * @param stack Scratch stack, reused across calls to avoid allocation
+ * @return true if balanced, false otherwise
+ */
+template <size_t N>
+bool is_balanced_parentheses(std::string_view expression, InlineStack<char, N>& stack) {
+    stack.clear();
+
+    for (char ch : expression) {
+        if (ch == '(' || ch == '[' || ch == '{') {
+            stack.push(ch);
+        } else if (ch == ')' || ch == ']' || ch == '}') {
+            if (stack.is_empty()) {
+                return false;
+            }
+
+            char top = stack.pop();
+            if ((ch == ')' && top != '(') ||
+                (ch == ']' && top != '[') ||
+                (ch == '}' && top != '{')) {
+                return false;
+            }
+        }
+    }
+
+    return stack.is_empty();
+}
+
+/**
+ * @brief Check if parentheses are balanced
+ *
+ * Takes a std::string_view, so callers can pass a std::string, a string
+ * literal, or a slice of a larger buffer without copying. Nesting up to
+ * 64 levels deep is handled without any heap allocation.
+ *
+ * @param expression String containing parentheses
  * @return true if balanced, false otherwise
  */
-bool is_balanced_parentheses(const std::string& expression) {
+bool is_balanced_parentheses(std::string_view expression) {
+    InlineStack<char, 64> stack;
+    return is_balanced_parentheses(expression, stack);
+}
+
+/**
+ * @brief Check many expressions, reusing one stack and the output vector
+ * @param expressions Expressions to check
+ * @param results Output: results[i] is true if expressions[i] is balanced
+ * @return Number of balanced expressions
+ */
+size_t is_balanced_parentheses_batch(const std::vector<std::string_view>& expressions,
+                                     std::vector<bool>& results) {
+    InlineStack<char, 64> stack;
+    results.resize(expressions.size());
+
+    size_t balanced = 0;
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        results[i] = is_balanced_parentheses(expressions[i], stack);
+        balanced += results[i] ? 1 : 0;
+    }
+    return balanced;
+}
+
+/**
+ * @brief Check if parentheses are balanced (original Stack<T> version)
+ * @param expression String containing parentheses
+ * @return true if balanced, false otherwise
+ */
+bool is_balanced_parentheses_basic(const std::string& expression) {
     Stack<char> stack;
 
     for (char ch : expression) {
@@ -276,6 +450,120 @@ int evaluate_postfix(const std::string& expression) {
     return stack.pop();
 }
 
+/**
+ * @brief Evaluate a whitespace-separated postfix expression without throwing
+ *
+ * Unlike evaluate_postfix, operands may have several digits (and a leading
+ * '-', e.g. "-12 4 /"). Tokens are sliced out of the string_view and parsed
+ * with std::from_chars, so no std::string is ever built.
+ *
+ * @param expression Postfix expression, tokens separated by whitespace
+ * @param stack Scratch stack, reused across calls to avoid allocation
+ * @param result Output: value of the expression
+ * @return false if the expression is malformed, overflows int, or divides by zero
+ */
+template <size_t N>
+bool try_evaluate_postfix(std::string_view expression, InlineStack<int, N>& stack, int& result) {
+    stack.clear();
+    size_t pos = 0;
+
+    while (pos < expression.size()) {
+        if (std::isspace(static_cast<unsigned char>(expression[pos]))) {
+            pos++;
+            continue;
+        }
+
+        size_t end = pos;
+        while (end < expression.size() && !std::isspace(static_cast<unsigned char>(expression[end]))) {
+            end++;
+        }
+        std::string_view token = expression.substr(pos, end - pos);
+        pos = end;
+
+        char op = token[0];
+        if (token.size() == 1 && (op == '+' || op == '-' || op == '*' || op == '/')) {
+            if (stack.size() < 2) {
+                return false;
+            }
+
+            int operand2 = stack.pop();
+            int operand1 = stack.pop();
+            long long value;
+
+            switch (op) {
+                case '+': value = static_cast<long long>(operand1) + operand2; break;
+                case '-': value = static_cast<long long>(operand1) - operand2; break;
+                case '*': value = static_cast<long long>(operand1) * operand2; break;
+                default:
+                    if (operand2 == 0) {
+                        return false;
+                    }
+                    value = static_cast<long long>(operand1) / operand2;
+                    break;
+            }
+
+            if (value < std::numeric_limits<int>::min() || value > std::numeric_limits<int>::max()) {
+                return false;
+            }
+            stack.push(static_cast<int>(value));
+        } else {
+            int number = 0;
+            auto parsed = std::from_chars(token.data(), token.data() + token.size(), number);
+            if (parsed.ec != std::errc() || parsed.ptr != token.data() + token.size()) {
+                return false;  // Not a number, or out of int range
+            }
+            stack.push(number);
+        }
+    }
+
+    if (stack.size() != 1) {
+        return false;
+    }
+
+    result = stack.pop();
+    return true;
+}
+
+/**
+ * @brief Evaluate a whitespace-separated postfix expression (multi-digit operands)
+ * @param expression Postfix expression, e.g. "12 30 + 4 *"
+ * @return Result of evaluation
+ */
+int evaluate_postfix_tokens(std::string_view expression) {
+    InlineStack<int, 64> stack;
+    int result = 0;
+    if (!try_evaluate_postfix(expression, stack, result)) {
+        throw std::invalid_argument("Invalid postfix expression");
+    }
+    return result;
+}
+
+/**
+ * @brief Evaluate many postfix expressions, reusing one stack and the outputs
+ *
+ * With output vectors that already have enough capacity (e.g. reused from
+ * the previous batch), the steady state performs zero heap allocations.
+ *
+ * @param expressions Postfix expressions to evaluate
+ * @param results Output: value of each valid expression (0 for invalid ones)
+ * @param valid Output: valid[i] is false if expressions[i] could not be evaluated
+ * @return Number of valid expressions
+ */
+size_t evaluate_postfix_batch(const std::vector<std::string_view>& expressions,
+                              std::vector<int>& results, std::vector<bool>& valid) {
+    InlineStack<int, 64> stack;
+    results.resize(expressions.size());
+    valid.resize(expressions.size());
+
+    size_t valid_count = 0;
+    for (size_t i = 0; i < expressions.size(); ++i) {
+        results[i] = 0;
+        valid[i] = try_evaluate_postfix(expressions[i], stack, results[i]);
+        valid_count += valid[i] ? 1 : 0;
+    }
+    return valid_count;
+}
+
 /**
  * @brief Reverse a string using stack
  * @param str String to reverse
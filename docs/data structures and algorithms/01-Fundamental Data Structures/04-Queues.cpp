@@ -2,6 +2,15 @@
 #include <vector>
 #include <stdexcept>
 #include <list>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "02-Linked Lists.cpp"  // NewDeleteAllocator, PoolAllocator
+#include "../02-Sorting Algorithms/00-Heap Utilities.cpp"  // heapify_dary, heap_sift_up_dary, build_heap_dary
 
 /**
  * @brief Queue Implementation using Dynamic Array (Circular Buffer)
@@ -155,9 +164,10 @@ public:
  * @brief Queue Implementation using Linked List
  *
  * This implementation demonstrates how to build a queue using a linked list
- * as the underlying data structure.
+ * as the underlying data structure. Use `LinkedListQueue<T, PoolAllocator>`
+ * to recycle nodes instead of calling new/delete on every enqueue/dequeue.
  */
-template <typename T>
+template <typename T, template <typename> class NodeAllocator = NewDeleteAllocator>
 class LinkedListQueue {
 private:
     struct Node {
@@ -169,6 +179,7 @@ private:
     Node* front_node;   // Pointer to front element
     Node* rear_node;    // Pointer to rear element
     size_t count;       // Number of elements
+    NodeAllocator<Node> allocator;  // Source of node memory
 
 public:
     /**
@@ -187,7 +198,7 @@ public:
      * @brief Add element to rear of queue
      */
     void enqueue(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = allocator.create(value);
 
         if (rear_node == nullptr) {
             // Queue is empty
@@ -209,14 +220,14 @@ public:
         }
 
         Node* temp = front_node;
-        T value = temp->data;
+        T value = std::move(temp->data);
         front_node = front_node->next;
 
         if (front_node == nullptr) {
             rear_node = nullptr;
         }
 
-        delete temp;
+        allocator.destroy(temp);
         count--;
         return value;
     }
@@ -245,9 +256,17 @@ public:
     size_t size() const { return count; }
 
     void clear() {
-        while (!is_empty()) {
-            dequeue();
+        if (NodeAllocator<Node>::can_release_all && std::is_trivially_destructible<T>::value) {
+            allocator.release_all();
+            front_node = nullptr;
+        }
+        while (front_node != nullptr) {
+            Node* temp = front_node;
+            front_node = front_node->next;
+            allocator.destroy(temp);
         }
+        rear_node = nullptr;
+        count = 0;
     }
 
     void print() const {
@@ -267,60 +286,156 @@ public:
 };
 
 /**
- * @brief Priority Queue Implementation
+ * @brief Priority Queue Implementation (indexed d-ary heap)
  *
  * Elements are served based on priority rather than insertion order.
- * Lower priority numbers are served first (min-heap behavior).
+ * Lower priority numbers are served first (min-heap behavior); elements
+ * with equal priority are served in insertion (FIFO) order.
+ *
+ * The elements live in one contiguous array arranged as a d-ary heap,
+ * using the generic heap primitives from 00-Heap Utilities.cpp. With the
+ * default Arity of 4 the tree is half as tall as a binary heap and all
+ * children of a node are adjacent in memory.
+ *
+ * Time Complexity:
+ * - Enqueue: O(log n)
+ * - Dequeue: O(log n)
+ * - Front/Peek: O(1)
+ * - push_bulk: O(n + m) for m new elements (Floyd's heap construction)
+ *
+ * Indexed mode (IndexedPriorityQueue<T>) additionally tracks where every
+ * element sits in the heap. enqueue() then returns a handle that can be
+ * passed to decrease_key() and erase(), both O(log n). This is what timer
+ * wheels and Dijkstra's algorithm need.
  */
-template <typename T>
+template <typename T, size_t Arity = 4, bool Indexed = false>
 class PriorityQueue {
+public:
+    using Handle = size_t;
+    static constexpr Handle invalid_handle = static_cast<Handle>(-1);
+
 private:
-    struct PriorityNode {
+    struct HeapEntry {
         T data;
         int priority;
-        PriorityNode* next;
-
-        PriorityNode(const T& value, int prio) : data(value), priority(prio), next(nullptr) {}
+        unsigned long long sequence;  // Insertion order, breaks priority ties
+        Handle handle;                // Only meaningful in indexed mode
     };
 
-    PriorityNode* head;  // Head of priority-sorted list
-    size_t count;        // Number of elements
+    /**
+     * @brief True when a should sit below b in the heap
+     */
+    struct ServedLater {
+        bool operator()(const HeapEntry& a, const HeapEntry& b) const {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.sequence > b.sequence;
+        }
+    };
 
-public:
     /**
-     * @brief Constructor - initialize empty priority queue
+     * @brief Keeps the handle -> heap index map current as entries move
      */
-    PriorityQueue() : head(nullptr), count(0) {}
+    struct TrackPosition {
+        PriorityQueue* queue;
+        void operator()(size_t pos) const {
+            if (Indexed) {
+                queue->positions[queue->heap[pos].handle] = pos;
+            }
+        }
+    };
+
+    std::vector<HeapEntry> heap;         // d-ary heap, best element at index 0
+    unsigned long long next_sequence;    // Sequence number for the next element
+    std::vector<size_t> positions;       // Indexed mode: handle -> heap index
+    std::vector<Handle> free_handles;    // Indexed mode: recycled handles
+
+    Handle acquire_handle() {
+        if (!Indexed) {
+            return invalid_handle;
+        }
+        if (!free_handles.empty()) {
+            Handle handle = free_handles.back();
+            free_handles.pop_back();
+            return handle;
+        }
+        positions.push_back(invalid_handle);
+        return positions.size() - 1;
+    }
+
+    void release_handle(Handle handle) {
+        if (Indexed) {
+            positions[handle] = invalid_handle;
+            free_handles.push_back(handle);
+        }
+    }
+
+    size_t position_of(Handle handle) const {
+        if (handle >= positions.size() || positions[handle] == invalid_handle) {
+            throw std::out_of_range("Invalid priority queue handle");
+        }
+        return positions[handle];
+    }
 
     /**
-     * @brief Destructor - free all allocated memory
+     * @brief Remove the entry at heap index pos and return it
      */
-    ~PriorityQueue() {
-        clear();
+    HeapEntry remove_at(size_t pos) {
+        HeapEntry removed = std::move(heap[pos]);
+        size_t last = heap.size() - 1;
+
+        if (pos != last) {
+            heap[pos] = std::move(heap[last]);
+            heap.pop_back();
+            TrackPosition track{this};
+            size_t moved_to = heapify_dary<Arity>(heap, heap.size(), pos, ServedLater(), track);
+            if (moved_to == pos) {
+                heap_sift_up_dary<Arity>(heap, pos, ServedLater(), track);
+            }
+        } else {
+            heap.pop_back();
+        }
+
+        release_handle(removed.handle);
+        return removed;
     }
 
+public:
+    /**
+     * @brief Constructor - initialize empty priority queue
+     */
+    PriorityQueue() : next_sequence(0) {}
+
     /**
      * @brief Add element with specified priority
      * @param value Element to add
      * @param priority Priority level (lower numbers = higher priority)
+     * @return Handle for decrease_key()/erase() (indexed mode only)
      */
-    void enqueue(const T& value, int priority) {
-        PriorityNode* new_node = new PriorityNode(value, priority);
+    Handle enqueue(const T& value, int priority) {
+        Handle handle = acquire_handle();
+        heap.push_back(HeapEntry{value, priority, next_sequence++, handle});
+        heap_sift_up_dary<Arity>(heap, heap.size() - 1, ServedLater(), TrackPosition{this});
+        return handle;
+    }
 
-        // Insert in correct position based on priority
-        if (head == nullptr || priority < head->priority) {
-            new_node->next = head;
-            head = new_node;
-        } else {
-            PriorityNode* current = head;
-            while (current->next != nullptr && current->next->priority <= priority) {
-                current = current->next;
+    /**
+     * @brief Add many elements at once, building the heap in linear time
+     * @param items (value, priority) pairs, enqueued in order
+     * @param handles_out Optional output for the handles (indexed mode only)
+     */
+    void push_bulk(const std::vector<std::pair<T, int>>& items,
+                   std::vector<Handle>* handles_out = nullptr) {
+        heap.reserve(heap.size() + items.size());
+        for (const auto& item : items) {
+            Handle handle = acquire_handle();
+            heap.push_back(HeapEntry{item.first, item.second, next_sequence++, handle});
+            if (handles_out != nullptr) {
+                handles_out->push_back(handle);
             }
-            new_node->next = current->next;
-            current->next = new_node;
         }
-
-        count++;
+        build_heap_dary<Arity>(heap, ServedLater(), TrackPosition{this});
     }
 
     /**
@@ -330,13 +445,7 @@ public:
         if (is_empty()) {
             throw std::out_of_range("Priority queue is empty");
         }
-
-        PriorityNode* temp = head;
-        T value = temp->data;
-        head = head->next;
-        delete temp;
-        count--;
-        return value;
+        return std::move(remove_at(0).data);
     }
 
     /**
@@ -346,34 +455,438 @@ public:
         if (is_empty()) {
             throw std::out_of_range("Priority queue is empty");
         }
-        return head->data;
+        return heap[0].data;
     }
 
-    bool is_empty() const { return head == nullptr; }
-    size_t size() const { return count; }
+    /**
+     * @brief Same as front()
+     */
+    const T& peek() const {
+        return front();
+    }
 
-    void clear() {
-        while (!is_empty()) {
-            dequeue();
+    /**
+     * @brief Lower the priority number of an element (serve it sooner)
+     * @param handle Handle returned by enqueue()
+     * @param new_priority New priority, must not be greater than the current one
+     */
+    void decrease_key(Handle handle, int new_priority) {
+        static_assert(Indexed, "decrease_key requires IndexedPriorityQueue");
+        size_t pos = position_of(handle);
+        if (new_priority > heap[pos].priority) {
+            throw std::invalid_argument("decrease_key cannot increase the priority number");
         }
+        heap[pos].priority = new_priority;
+        heap_sift_up_dary<Arity>(heap, pos, ServedLater(), TrackPosition{this});
+    }
+
+    /**
+     * @brief Remove an arbitrary element
+     * @param handle Handle returned by enqueue()
+     * @return The removed element
+     */
+    T erase(Handle handle) {
+        static_assert(Indexed, "erase requires IndexedPriorityQueue");
+        return std::move(remove_at(position_of(handle)).data);
+    }
+
+    /**
+     * @brief Check whether a handle still refers to a queued element
+     */
+    bool contains(Handle handle) const {
+        return Indexed && handle < positions.size() && positions[handle] != invalid_handle;
+    }
+
+    /**
+     * @brief Current priority of a queued element (indexed mode only)
+     */
+    int priority_of(Handle handle) const {
+        static_assert(Indexed, "priority_of requires IndexedPriorityQueue");
+        return heap[position_of(handle)].priority;
+    }
+
+    bool is_empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+
+    void clear() {
+        heap.clear();
+        positions.clear();
+        free_handles.clear();
     }
 
     void print() const {
+        // Heap order is not serving order, so print a sorted copy
+        std::vector<const HeapEntry*> order;
+        for (const auto& entry : heap) {
+            order.push_back(&entry);
+        }
+        std::sort(order.begin(), order.end(), [](const HeapEntry* a, const HeapEntry* b) {
+            return ServedLater()(*b, *a);
+        });
+
         std::cout << "PriorityQueue (priority -> data): [";
-        PriorityNode* current = head;
         bool first = true;
-        while (current != nullptr) {
+        for (const HeapEntry* entry : order) {
             if (!first) {
                 std::cout << ", ";
             }
-            std::cout << "(" << current->priority << "->" << current->data << ")";
-            current = current->next;
+            std::cout << "(" << entry->priority << "->" << entry->data << ")";
             first = false;
         }
         std::cout << "]" << std::endl;
     }
 };
 
+/**
+ * @brief PriorityQueue that returns handles for decrease_key() and erase()
+ */
+template <typename T, size_t Arity = 4>
+using IndexedPriorityQueue = PriorityQueue<T, Arity, true>;
+
+/**
+ * @brief Cache line size used to pad the lock-free queues' indices
+ *
+ * Producer and consumer indices live on different cache lines so that a
+ * write by one side does not invalidate the line the other side is reading
+ * (false sharing).
+ */
+constexpr size_t queue_cache_line_size = 64;
+
+/**
+ * @brief Round a capacity up to the next power of two (minimum 2)
+ */
+inline size_t round_up_to_power_of_two(size_t n) {
+    size_t capacity = 2;
+    while (capacity < n) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+/**
+ * @brief Bounded lock-free Single-Producer Single-Consumer queue
+ *
+ * The same circular buffer idea as Queue<T>, but with a fixed capacity and
+ * safe for exactly one producer thread and one consumer thread:
+ * - tail is written only by the producer, head only by the consumer
+ * - A release store publishes an index, and the other side's acquire load
+ *   makes the element written before it visible
+ * - Each side keeps a cached copy of the other side's index and only
+ *   reloads it when the queue looks full (or empty), so the common case
+ *   touches no shared cache line except the slot itself
+ * - Capacity is a power of two and indices grow without wrapping, so the
+ *   slot is `index & mask` and full/empty checks are plain subtraction
+ *
+ * Nothing is ever reallocated: try_enqueue fails when the queue is full.
+ *
+ * Time Complexity:
+ * - try_enqueue / try_dequeue: O(1), wait-free
+ * - Bulk operations: O(k) with one index publish per batch
+ */
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> buffer;   // Fixed circular storage
+    size_t mask;             // capacity - 1
+
+    alignas(queue_cache_line_size) std::atomic<size_t> head;  // Next slot to read (consumer)
+    size_t cached_tail;                                        // Consumer's view of tail
+
+    alignas(queue_cache_line_size) std::atomic<size_t> tail;  // Next slot to write (producer)
+    size_t cached_head;                                        // Producer's view of head
+
+    /**
+     * @brief Free slots as seen by the producer, refreshing head if needed
+     */
+    size_t free_slots(size_t current_tail, size_t wanted) {
+        size_t free_count = buffer.size() - (current_tail - cached_head);
+        if (free_count < wanted) {
+            cached_head = head.load(std::memory_order_acquire);
+            free_count = buffer.size() - (current_tail - cached_head);
+        }
+        return free_count;
+    }
+
+    /**
+     * @brief Filled slots as seen by the consumer, refreshing tail if needed
+     */
+    size_t filled_slots(size_t current_head, size_t wanted) {
+        size_t filled = cached_tail - current_head;
+        if (filled < wanted) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            filled = cached_tail - current_head;
+        }
+        return filled;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of queued elements (rounded up to a power of two)
+     */
+    explicit SpscQueue(size_t capacity = 1024)
+        : buffer(round_up_to_power_of_two(capacity)), mask(buffer.size() - 1),
+          head(0), cached_tail(0), tail(0), cached_head(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief Add element to rear of queue (producer thread only)
+     * @return false if the queue is full
+     */
+    bool try_enqueue(const T& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (free_slots(t, 1) == 0) {
+            return false;
+        }
+        buffer[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_enqueue(T&& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (free_slots(t, 1) == 0) {
+            return false;
+        }
+        buffer[t & mask] = std::move(value);
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove front element into out (consumer thread only)
+     * @return false if the queue is empty
+     */
+    bool try_dequeue(T& out) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (filled_slots(h, 1) == 0) {
+            return false;
+        }
+        out = std::move(buffer[h & mask]);
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Enqueue up to count elements from first, publishing them at once
+     * @return Number of elements actually enqueued
+     */
+    template <typename InputIt>
+    size_t try_enqueue_bulk(InputIt first, size_t count) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t n = std::min(count, free_slots(t, count));
+        for (size_t i = 0; i < n; ++i, ++first) {
+            buffer[(t + i) & mask] = *first;
+        }
+        if (n > 0) {
+            tail.store(t + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Dequeue up to max_count elements into out
+     * @return Number of elements actually dequeued
+     */
+    template <typename OutputIt>
+    size_t try_dequeue_bulk(OutputIt out, size_t max_count) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t n = std::min(max_count, filled_slots(h, max_count));
+        for (size_t i = 0; i < n; ++i, ++out) {
+            *out = std::move(buffer[(h + i) & mask]);
+        }
+        if (n > 0) {
+            head.store(h + n, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Approximate number of queued elements (exact when quiescent)
+     */
+    size_t size() const {
+        size_t t = tail.load(std::memory_order_acquire);
+        size_t h = head.load(std::memory_order_acquire);
+        return t - h;
+    }
+
+    bool is_empty() const { return size() == 0; }
+    size_t capacity() const { return buffer.size(); }
+};
+
+/**
+ * @brief Bounded lock-free Multi-Producer Multi-Consumer queue
+ *
+ * Ring of cells where every cell carries a sequence number (Dmitry Vyukov's
+ * bounded MPMC design):
+ * - cell.sequence == pos      -> the cell is free for the producer at pos
+ * - cell.sequence == pos + 1  -> the cell holds the element for the consumer at pos
+ * Producers and consumers claim positions with a compare-and-swap on their
+ * own padded index and then hand the cell over with a release store of the
+ * next sequence number. There is no shared lock and no allocation after
+ * construction.
+ *
+ * Bulk operations claim a run of consecutive positions with a single CAS,
+ * so a batch of k elements costs one contended atomic instead of k.
+ *
+ * Time Complexity:
+ * - try_enqueue / try_dequeue: O(1) expected, lock-free
+ */
+template <typename T>
+class MpmcQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    std::vector<Cell> cells;
+    size_t mask;
+
+    alignas(queue_cache_line_size) std::atomic<size_t> enqueue_pos;
+    alignas(queue_cache_line_size) std::atomic<size_t> dequeue_pos;
+
+    /**
+     * @brief Claim up to wanted consecutive positions on index
+     * @param index enqueue_pos or dequeue_pos
+     * @param ready_offset 0 for producers (cell free), 1 for consumers (cell full)
+     * @param start Output: first claimed position
+     * @return Number of positions claimed (0 if full/empty)
+     */
+    size_t claim(std::atomic<size_t>& index, size_t ready_offset, size_t wanted, size_t& start) {
+        size_t pos = index.load(std::memory_order_relaxed);
+        while (true) {
+            // Count how many cells from pos on are ready for this side
+            size_t n = 0;
+            while (n < wanted && n <= mask) {
+                size_t seq = cells[(pos + n) & mask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + n + ready_offset) {
+                    break;
+                }
+                n++;
+            }
+
+            if (n == 0) {
+                size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+                if (static_cast<std::ptrdiff_t>(seq - (pos + ready_offset)) < 0) {
+                    return 0;  // Genuinely full (producer) or empty (consumer)
+                }
+                pos = index.load(std::memory_order_relaxed);  // Another thread moved on
+                continue;
+            }
+
+            if (index.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                start = pos;
+                return n;
+            }
+            // CAS failure reloaded pos; try again
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum number of queued elements (rounded up to a power of two)
+     */
+    explicit MpmcQueue(size_t capacity = 1024)
+        : cells(round_up_to_power_of_two(capacity)), mask(cells.size() - 1),
+          enqueue_pos(0), dequeue_pos(0) {
+        for (size_t i = 0; i < cells.size(); ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Add element to rear of queue (any thread)
+     * @return false if the queue is full
+     */
+    bool try_enqueue(const T& value) {
+        size_t pos;
+        if (claim(enqueue_pos, 0, 1, pos) == 0) {
+            return false;
+        }
+        Cell& cell = cells[pos & mask];
+        cell.data = value;
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_enqueue(T&& value) {
+        size_t pos;
+        if (claim(enqueue_pos, 0, 1, pos) == 0) {
+            return false;
+        }
+        Cell& cell = cells[pos & mask];
+        cell.data = std::move(value);
+        cell.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove front element into out (any thread)
+     * @return false if the queue is empty
+     */
+    bool try_dequeue(T& out) {
+        size_t pos;
+        if (claim(dequeue_pos, 1, 1, pos) == 0) {
+            return false;
+        }
+        Cell& cell = cells[pos & mask];
+        out = std::move(cell.data);
+        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Enqueue up to count elements from first with one claim
+     * @return Number of elements actually enqueued
+     */
+    template <typename InputIt>
+    size_t try_enqueue_bulk(InputIt first, size_t count) {
+        size_t pos;
+        size_t n = claim(enqueue_pos, 0, count, pos);
+        for (size_t i = 0; i < n; ++i, ++first) {
+            Cell& cell = cells[(pos + i) & mask];
+            cell.data = *first;
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Dequeue up to max_count elements into out with one claim
+     * @return Number of elements actually dequeued
+     */
+    template <typename OutputIt>
+    size_t try_dequeue_bulk(OutputIt out, size_t max_count) {
+        size_t pos;
+        size_t n = claim(dequeue_pos, 1, max_count, pos);
+        for (size_t i = 0; i < n; ++i, ++out) {
+            Cell& cell = cells[(pos + i) & mask];
+            *out = std::move(cell.data);
+            cell.sequence.store(pos + i + mask + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Approximate number of queued elements (exact when quiescent)
+     */
+    size_t size() const {
+        size_t e = enqueue_pos.load(std::memory_order_acquire);
+        size_t d = dequeue_pos.load(std::memory_order_acquire);
+        return e > d ? e - d : 0;
+    }
+
+    bool is_empty() const { return size() == 0; }
+    size_t capacity() const { return cells.size(); }
+};
+
 /**
  * @brief Queue Applications and Examples
  */
@@ -494,4 +1007,209 @@ public:
     size_t size() const {
         return stack1.size() + stack2.size();
     }
-};
\ No newline at end of file
+};
+
+/**
+ * @brief Time a churn workload and return elapsed microseconds
+ */
+template <typename Workload>
+long long time_node_workload(Workload workload) {
+    auto start = std::chrono::high_resolution_clock::now();
+    workload();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+/**
+ * @brief Performance comparison of NewDeleteAllocator vs PoolAllocator
+ *
+ * Runs the same node churn through each linked container with both
+ * allocators:
+ * - Queue: a sliding window of 1,000 elements, 2,000,000 enqueue/dequeue pairs
+ * - Stack: bursts of 1,000 pushes followed by 1,000 pops
+ * - List: build 10,000 nodes with push_back, then clear(), repeated
+ */
+void compare_node_allocators() {
+    const int ops = 2000000;
+    long long checksum = 0;
+
+    std::cout << "\n=== Node Allocator Comparison ===" << std::endl;
+
+    auto queue_churn = [&](auto& queue) {
+        for (int i = 0; i < 1000; ++i) queue.enqueue(i);
+        for (int i = 0; i < ops; ++i) {
+            queue.enqueue(i);
+            checksum += queue.dequeue();
+        }
+        queue.clear();
+    };
+    auto stack_churn = [&](auto& stack) {
+        for (int burst = 0; burst < ops / 1000; ++burst) {
+            for (int i = 0; i < 1000; ++i) stack.push(i);
+            for (int i = 0; i < 1000; ++i) checksum += stack.pop();
+        }
+    };
+    auto list_churn = [&](auto& list) {
+        for (int round = 0; round < ops / 10000; ++round) {
+            for (int i = 0; i < 10000; ++i) list.push_back(i);
+            checksum += static_cast<long long>(list.size());
+            list.clear();
+        }
+    };
+
+    LinkedListQueue<int> heap_queue;
+    LinkedListQueue<int, PoolAllocator> pool_queue;
+    long long q1 = time_node_workload([&] { queue_churn(heap_queue); });
+    long long q2 = time_node_workload([&] { queue_churn(pool_queue); });
+
+    LinkedListStack<int> heap_stack;
+    LinkedListStack<int, PoolAllocator> pool_stack;
+    long long s1 = time_node_workload([&] { stack_churn(heap_stack); });
+    long long s2 = time_node_workload([&] { stack_churn(pool_stack); });
+
+    SinglyLinkedList<int> heap_list;
+    SinglyLinkedList<int, PoolAllocator> pool_list;
+    long long l1 = time_node_workload([&] { list_churn(heap_list); });
+    long long l2 = time_node_workload([&] { list_churn(pool_list); });
+
+    std::cout << "LinkedListQueue  new/delete: " << q1 << " μs, pool: " << q2 << " μs" << std::endl;
+    std::cout << "LinkedListStack  new/delete: " << s1 << " μs, pool: " << s2 << " μs" << std::endl;
+    std::cout << "SinglyLinkedList new/delete: " << l1 << " μs, pool: " << l2 << " μs" << std::endl;
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+}
+
+
+/**
+ * @brief Queue<T> behind a single mutex, the baseline for the ring buffers
+ */
+template <typename T>
+class MutexQueue {
+private:
+    Queue<T> queue;
+    std::mutex mutex;
+
+public:
+    bool try_enqueue(const T& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(value);
+        return true;
+    }
+
+    bool try_dequeue(T& out) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.is_empty()) {
+            return false;
+        }
+        out = queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * @brief Move `items` integers through a queue with the given thread counts
+ * @return Throughput in million items per second
+ */
+template <typename QueueType>
+double measure_queue_throughput(QueueType& queue, int producers, int consumers, long long items) {
+    std::atomic<long long> consumed(0);
+    long long per_producer = items / producers;
+    long long total = per_producer * producers;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            for (long long i = 0; i < per_producer; ++i) {
+                while (!queue.try_enqueue(static_cast<int>(i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            int value;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_dequeue(value)) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double seconds = std::chrono::duration<double>(end - start).count();
+    return total / seconds / 1e6;
+}
+
+/**
+ * @brief Average round-trip latency of a ping-pong between two threads
+ * @return Nanoseconds per round trip
+ */
+template <typename QueueType>
+double measure_queue_round_trip(QueueType& ping, QueueType& pong, int round_trips) {
+    std::thread echo([&] {
+        int value;
+        for (int i = 0; i < round_trips; ++i) {
+            while (!ping.try_dequeue(value)) {
+                std::this_thread::yield();
+            }
+            while (!pong.try_enqueue(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    auto start = std::chrono::high_resolution_clock::now();
+    int value;
+    for (int i = 0; i < round_trips; ++i) {
+        while (!ping.try_enqueue(i)) {
+            std::this_thread::yield();
+        }
+        while (!pong.try_dequeue(value)) {
+            std::this_thread::yield();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    echo.join();
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / round_trips;
+}
+
+/**
+ * @brief Performance comparison of SpscQueue, MpmcQueue and a mutex-wrapped Queue<T>
+ *
+ * Throughput is measured with one producer and one consumer (all three
+ * queues) and with four of each (MpmcQueue and the mutex queue only).
+ * Latency is the average round trip of a ping-pong between two threads.
+ */
+void compare_ring_buffers() {
+    const long long items = 5000000;
+    const int round_trips = 100000;
+
+    std::cout << "\n=== Ring Buffer Comparison (" << items << " items) ===" << std::endl;
+
+    SpscQueue<int> spsc(4096);
+    MpmcQueue<int> mpmc(4096);
+    MutexQueue<int> locked;
+    std::cout << "1P/1C SpscQueue:  " << measure_queue_throughput(spsc, 1, 1, items) << " M items/s" << std::endl;
+    std::cout << "1P/1C MpmcQueue:  " << measure_queue_throughput(mpmc, 1, 1, items) << " M items/s" << std::endl;
+    std::cout << "1P/1C MutexQueue: " << measure_queue_throughput(locked, 1, 1, items) << " M items/s" << std::endl;
+
+    MpmcQueue<int> mpmc4(4096);
+    MutexQueue<int> locked4;
+    std::cout << "4P/4C MpmcQueue:  " << measure_queue_throughput(mpmc4, 4, 4, items) << " M items/s" << std::endl;
+    std::cout << "4P/4C MutexQueue: " << measure_queue_throughput(locked4, 4, 4, items) << " M items/s" << std::endl;
+
+    SpscQueue<int> spsc_ping(64), spsc_pong(64);
+    MpmcQueue<int> mpmc_ping(64), mpmc_pong(64);
+    MutexQueue<int> locked_ping, locked_pong;
+    std::cout << "Round trip SpscQueue:  " << measure_queue_round_trip(spsc_ping, spsc_pong, round_trips) << " ns" << std::endl;
+    std::cout << "Round trip MpmcQueue:  " << measure_queue_round_trip(mpmc_ping, mpmc_pong, round_trips) << " ns" << std::endl;
+    std::cout << "Round trip MutexQueue: " << measure_queue_round_trip(locked_ping, locked_pong, round_trips) << " ns" << std::endl;
+}
@@ -4,6 +4,88 @@
 #include <functional>
 #include <stdexcept>
 #include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define HASH_TABLE_USE_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HASH_TABLE_USE_NEON 1
+#endif
+
+/**
+ * @brief Occupancy and probe-length snapshot returned by stats()
+ *
+ * The histogram means different things per table layout:
+ * - HashTable (chaining): histogram[i] = number of buckets whose chain has i entries
+ * - Open addressing: histogram[i] = number of keys found after i probes
+ *   (slots for OpenAddressingHashTable, 16-slot groups for SwissHashTable)
+ * mean_probe_length is comparable across layouts: the average number of
+ * key comparisons (chaining) or probes (open addressing) that a successful
+ * lookup of a stored key performs.
+ *
+ * memory_bytes counts the table's own storage (bucket arrays, list nodes,
+ * control bytes), not heap memory owned by the keys and values themselves.
+ */
+struct HashTableStats {
+    size_t size = 0;                 // Stored elements
+    size_t buckets = 0;              // Buckets (chaining) or slots (open addressing)
+    size_t tombstones = 0;           // DELETED slots (open addressing only)
+    double load_factor = 0.0;
+    size_t memory_bytes = 0;
+    size_t max_probe_length = 0;     // Longest chain / longest probe sequence
+    double mean_probe_length = 0.0;  // Average cost of a successful lookup
+    std::vector<size_t> histogram;
+
+    double bytes_per_entry() const {
+        return size == 0 ? 0.0 : static_cast<double>(memory_bytes) / size;
+    }
+
+    void record(size_t length, size_t count = 1) {
+        if (histogram.size() <= length) {
+            histogram.resize(length + 1, 0);
+        }
+        histogram[length] += count;
+        max_probe_length = std::max(max_probe_length, length);
+    }
+
+    void print() const {
+        std::cout << "  size " << size << ", buckets " << buckets
+                  << ", load " << std::fixed << std::setprecision(2) << load_factor
+                  << ", " << bytes_per_entry() << " B/entry"
+                  << ", mean probe " << mean_probe_length
+                  << ", max probe " << max_probe_length;
+        if (tombstones > 0) {
+            std::cout << ", tombstones " << tombstones;
+        }
+        std::cout << std::endl << "  histogram:";
+        for (size_t i = 0; i < histogram.size(); ++i) {
+            if (histogram[i] != 0) {
+                std::cout << " " << i << ":" << histogram[i];
+            }
+        }
+        std::cout << std::defaultfloat << std::endl;
+    }
+};
 
 /**
  * @brief Hash Table Implementation using Separate Chaining
@@ -27,6 +109,14 @@
  * - Caches
  * - Symbol tables in compilers
  * - Associative arrays
+ *
+ * Resizing:
+ * By default the table doubles in one pass when the load factor is exceeded.
+ * In incremental mode the old and new bucket arrays live side by side, and
+ * every insert/get/remove migrates at most buckets_per_step old buckets,
+ * so no single operation pays for the whole rehash. Nodes are spliced
+ * between lists, so migration never copies or reallocates a pair.
+ * reserve() pre-sizes the table so that no resize happens at all.
  */
 template <typename K, typename V>
 class HashTable {
@@ -46,6 +136,12 @@ private:
     size_t num_buckets;                            // Number of buckets
     const double max_load_factor = 0.75;           // Maximum load factor before rehashing
 
+    // Incremental resize state
+    bool incremental;                                  // Spread rehash work across operations
+    std::vector<std::list<KeyValuePair>> old_buckets;  // Buckets still being drained
+    size_t migrate_index;                              // Next old bucket to migrate
+    const size_t buckets_per_step = 4;                 // Old buckets migrated per operation
+
     /**
      * @brief Hash function for keys
      * @param key Key to hash
@@ -56,25 +152,139 @@ private:
         return std::hash<K>{}(key) % num_buckets;
     }
 
+    /**
+     * @brief Bucket index of a key in the old bucket array
+     */
+    size_t old_hash(const K& key) const {
+        return std::hash<K>{}(key) % old_buckets.size();
+    }
+
     /**
      * @brief Resize and rehash all elements when load factor is exceeded
      */
     void rehash() {
-        std::vector<std::list<KeyValuePair>> old_buckets = std::move(buckets);
-        size_t old_num_buckets = num_buckets;
+        if (incremental) {
+            start_migration(num_buckets * 2);
+        } else {
+            rehash_to(num_buckets * 2);
+        }
+    }
 
-        // Double the number of buckets
-        num_buckets *= 2;
+    /**
+     * @brief Move every element into a table with new_num_buckets buckets
+     * @param new_num_buckets Number of buckets after the rehash
+     */
+    void rehash_to(size_t new_num_buckets) {
+        finish_migration();
+
+        std::vector<std::list<KeyValuePair>> previous = std::move(buckets);
+        num_buckets = new_num_buckets;
         buckets.clear();
         buckets.resize(num_buckets);
-        num_elements = 0;
 
-        // Reinsert all elements into new buckets
-        for (size_t i = 0; i < old_num_buckets; ++i) {
-            for (const auto& pair : old_buckets[i]) {
-                insert(pair.key, pair.value);
+        for (auto& bucket : previous) {
+            while (!bucket.empty()) {
+                auto& target = buckets[hash(bucket.front().key)];
+                target.splice(target.begin(), bucket, bucket.begin());
+            }
+        }
+    }
+
+    /**
+     * @brief Begin draining the current buckets into a larger array
+     * @param new_num_buckets Number of buckets of the new array
+     */
+    void start_migration(size_t new_num_buckets) {
+        finish_migration();
+
+        old_buckets = std::move(buckets);
+        migrate_index = 0;
+        num_buckets = new_num_buckets;
+        buckets.clear();
+        buckets.resize(num_buckets);
+    }
+
+    /**
+     * @brief Move up to max_buckets old buckets into the new array
+     */
+    void migrate_step(size_t max_buckets) {
+        for (size_t moved = 0; moved < max_buckets && is_rehashing(); ++moved) {
+            auto& bucket = old_buckets[migrate_index];
+            while (!bucket.empty()) {
+                auto& target = buckets[hash(bucket.front().key)];
+                target.splice(target.begin(), bucket, bucket.begin());
+            }
+
+            if (++migrate_index == old_buckets.size()) {
+                old_buckets.clear();
+                old_buckets.shrink_to_fit();
+                migrate_index = 0;
+            }
+        }
+    }
+
+    /**
+     * @brief Complete any in-progress migration in one pass
+     */
+    void finish_migration() {
+        if (is_rehashing()) {
+            migrate_step(old_buckets.size() - migrate_index);
+        }
+    }
+
+    /**
+     * @brief Locate the bucket (new or not-yet-migrated old) that holds key
+     * @param key Key to find
+     * @param it Output parameter for iterator to key-value pair
+     * @return Pointer to the bucket containing key, or nullptr if absent
+     */
+    std::list<KeyValuePair>* find_bucket(const K& key,
+                                         typename std::list<KeyValuePair>::iterator& it) {
+        auto& bucket = buckets[hash(key)];
+        for (it = bucket.begin(); it != bucket.end(); ++it) {
+            if (it->key == key) {
+                return &bucket;
+            }
+        }
+
+        if (is_rehashing()) {
+            size_t old_idx = old_hash(key);
+            if (old_idx >= migrate_index) {
+                auto& old_bucket = old_buckets[old_idx];
+                for (it = old_bucket.begin(); it != old_bucket.end(); ++it) {
+                    if (it->key == key) {
+                        return &old_bucket;
+                    }
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Find the key-value pair for a key (const lookup, no migration)
+     * @return Pointer to the pair, or nullptr if absent
+     */
+    const KeyValuePair* find_pair(const K& key) const {
+        for (const auto& pair : buckets[hash(key)]) {
+            if (pair.key == key) {
+                return &pair;
+            }
+        }
+
+        if (is_rehashing()) {
+            size_t old_idx = old_hash(key);
+            if (old_idx >= migrate_index) {
+                for (const auto& pair : old_buckets[old_idx]) {
+                    if (pair.key == key) {
+                        return &pair;
+                    }
+                }
             }
         }
+
+        return nullptr;
     }
 
     /**
@@ -87,23 +297,19 @@ private:
     bool find_with_iterator(const K& key, size_t& bucket_idx,
                            typename std::list<KeyValuePair>::iterator& it) {
         bucket_idx = hash(key);
-        auto& bucket = buckets[bucket_idx];
-
-        for (it = bucket.begin(); it != bucket.end(); ++it) {
-            if (it->key == key) {
-                return true;
-            }
-        }
-
-        return false;
+        return find_bucket(key, it) != nullptr;
     }
 
 public:
     /**
      * @brief Constructor with initial number of buckets
      * @param initial_size Initial number of buckets
+     * @param incremental_rehash Spread resize work across operations instead
+     *        of rehashing everything at once
      */
-    HashTable(size_t initial_size = 16) : num_elements(0), num_buckets(initial_size) {
+    HashTable(size_t initial_size = 16, bool incremental_rehash = false)
+        : num_elements(0), num_buckets(initial_size),
+          incremental(incremental_rehash), migrate_index(0) {
         buckets.resize(num_buckets);
     }
 
@@ -113,24 +319,21 @@ public:
      * @param value Value to associate with key
      */
     void insert(const K& key, const V& value) {
+        migrate_step(buckets_per_step);
+
         // Check if we need to rehash
         if (static_cast<double>(num_elements) / num_buckets > max_load_factor) {
             rehash();
         }
 
-        size_t bucket_idx = hash(key);
-        auto& bucket = buckets[bucket_idx];
-
-        // Check if key already exists
-        for (auto& pair : bucket) {
-            if (pair.key == key) {
-                pair.value = value;  // Update existing value
-                return;
-            }
+        typename std::list<KeyValuePair>::iterator it;
+        if (find_bucket(key, it) != nullptr) {
+            it->value = value;  // Update existing value
+            return;
         }
 
-        // Insert new key-value pair
-        bucket.emplace_front(key, value);
+        // New keys always go into the new bucket array
+        buckets[hash(key)].emplace_front(key, value);
         num_elements++;
     }
 
@@ -140,18 +343,17 @@ public:
      * @return true if key was removed, false if key didn't exist
      */
     bool remove(const K& key) {
-        size_t bucket_idx = hash(key);
-        auto& bucket = buckets[bucket_idx];
+        migrate_step(buckets_per_step);
 
-        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-            if (it->key == key) {
-                bucket.erase(it);
-                num_elements--;
-                return true;
-            }
+        typename std::list<KeyValuePair>::iterator it;
+        std::list<KeyValuePair>* bucket = find_bucket(key, it);
+        if (bucket == nullptr) {
+            return false;  // Key not found
         }
 
-        return false;  // Key not found
+        bucket->erase(it);
+        num_elements--;
+        return true;
     }
 
     /**
@@ -160,6 +362,8 @@ public:
      * @return Reference to value
      */
     V& get(const K& key) {
+        migrate_step(buckets_per_step);
+
         size_t bucket_idx;
         typename std::list<KeyValuePair>::iterator it;
 
@@ -174,13 +378,9 @@ public:
      * @brief Get value associated with key (const version)
      */
     const V& get(const K& key) const {
-        size_t bucket_idx = hash(key);
-        const auto& bucket = buckets[bucket_idx];
-
-        for (const auto& pair : bucket) {
-            if (pair.key == key) {
-                return pair.value;
-            }
+        const KeyValuePair* pair = find_pair(key);
+        if (pair != nullptr) {
+            return pair->value;
         }
 
         throw std::out_of_range("Key not found in hash table");
@@ -192,16 +392,37 @@ public:
      * @return true if key exists, false otherwise
      */
     bool contains(const K& key) const {
-        size_t bucket_idx = hash(key);
-        const auto& bucket = buckets[bucket_idx];
+        return find_pair(key) != nullptr;
+    }
 
-        for (const auto& pair : bucket) {
-            if (pair.key == key) {
-                return true;
-            }
+    /**
+     * @brief Pre-size the table so that n elements fit without any resize
+     * @param n Number of elements to make room for
+     */
+    void reserve(size_t n) {
+        size_t needed = static_cast<size_t>(static_cast<double>(n) / max_load_factor) + 1;
+        if (needed > num_buckets) {
+            rehash_to(needed);
+        } else {
+            finish_migration();
         }
+    }
 
-        return false;
+    /**
+     * @brief Check if an incremental resize is in progress
+     */
+    bool is_rehashing() const {
+        return !old_buckets.empty();
+    }
+
+    /**
+     * @brief Fraction of old buckets already migrated (1.0 when idle)
+     */
+    double rehash_progress() const {
+        if (!is_rehashing()) {
+            return 1.0;
+        }
+        return static_cast<double>(migrate_index) / old_buckets.size();
     }
 
     /**
@@ -232,6 +453,8 @@ public:
         for (auto& bucket : buckets) {
             bucket.clear();
         }
+        old_buckets.clear();
+        migrate_index = 0;
         num_elements = 0;
     }
 
@@ -245,6 +468,11 @@ public:
                 keys.push_back(pair.key);
             }
         }
+        for (size_t i = migrate_index; i < old_buckets.size(); ++i) {
+            for (const auto& pair : old_buckets[i]) {
+                keys.push_back(pair.key);
+            }
+        }
         return keys;
     }
 
@@ -258,6 +486,11 @@ public:
                 values.push_back(pair.value);
             }
         }
+        for (size_t i = migrate_index; i < old_buckets.size(); ++i) {
+            for (const auto& pair : old_buckets[i]) {
+                values.push_back(pair.value);
+            }
+        }
         return values;
     }
 
@@ -276,6 +509,53 @@ public:
                 std::cout << std::endl;
             }
         }
+        for (size_t i = migrate_index; i < old_buckets.size(); ++i) {
+            const auto& bucket = old_buckets[i];
+            if (!bucket.empty()) {
+                std::cout << "  Old bucket " << i << ": ";
+                for (const auto& pair : bucket) {
+                    std::cout << "[" << pair.key << ": " << pair.value << "] ";
+                }
+                std::cout << std::endl;
+            }
+        }
+    }
+
+    /**
+     * @brief Chain-length histogram and memory footprint
+     *
+     * Buckets still waiting to be migrated by an incremental rehash are
+     * included, so the numbers describe what lookups actually walk.
+     */
+    HashTableStats stats() const {
+        // std::list node: the pair plus next/prev pointers
+        const size_t node_bytes = sizeof(KeyValuePair) + 2 * sizeof(void*);
+
+        HashTableStats result;
+        result.size = num_elements;
+        result.buckets = num_buckets;
+        result.load_factor = load_factor();
+        result.memory_bytes = buckets.capacity() * sizeof(std::list<KeyValuePair>) +
+                              old_buckets.capacity() * sizeof(std::list<KeyValuePair>) +
+                              num_elements * node_bytes;
+
+        size_t comparisons = 0;
+        auto record_bucket = [&](const std::list<KeyValuePair>& bucket) {
+            size_t length = bucket.size();
+            result.record(length);
+            comparisons += length * (length + 1) / 2;  // i-th entry costs i comparisons
+        };
+        for (const auto& bucket : buckets) {
+            record_bucket(bucket);
+        }
+        for (size_t i = migrate_index; i < old_buckets.size(); ++i) {
+            record_bucket(old_buckets[i]);
+        }
+
+        if (num_elements > 0) {
+            result.mean_probe_length = static_cast<double>(comparisons) / num_elements;
+        }
+        return result;
     }
 
     /**
@@ -442,92 +722,1344 @@ public:
     size_t size() const { return num_elements; }
     bool is_empty() const { return num_elements == 0; }
     double load_factor() const { return static_cast<double>(num_elements) / num_buckets; }
+
+    /**
+     * @brief Probe-length histogram (in slots) and memory footprint
+     */
+    HashTableStats stats() const {
+        HashTableStats result;
+        result.size = num_elements;
+        result.buckets = num_buckets;
+        result.load_factor = load_factor();
+        result.memory_bytes = entries.capacity() * sizeof(Entry);
+
+        size_t total_probes = 0;
+        for (size_t i = 0; i < num_buckets; ++i) {
+            if (entries[i].state == EntryState::DELETED) {
+                result.tombstones++;
+            } else if (entries[i].state == EntryState::OCCUPIED) {
+                size_t probes = (i + num_buckets - hash(entries[i].key)) % num_buckets + 1;
+                result.record(probes);
+                total_probes += probes;
+            }
+        }
+
+        if (num_elements > 0) {
+            result.mean_probe_length = static_cast<double>(total_probes) / num_elements;
+        }
+        return result;
+    }
 };
 
 /**
- * @brief Hash Table Applications and Examples
+ * @brief 16-slot group of control bytes for SwissHashTable
+ *
+ * Each slot of a SwissHashTable has a one-byte control word:
+ * - 0x80 (EMPTY)    - slot has never been used since the last cleanup
+ * - 0xFE (DELETED)  - tombstone left behind by remove()
+ * - 0x00..0x7F      - slot is occupied, value holds 7 bits of the key hash (H2)
+ *
+ * The group compares all 16 control bytes against a byte in one instruction
+ * (SSE2 on x86, NEON on AArch64, a plain loop elsewhere) and returns a
+ * bitmask with bit i set when slot i matches.
  */
+struct ControlGroup {
+    static constexpr size_t WIDTH = 16;
+    static constexpr uint8_t EMPTY = 0x80;
+    static constexpr uint8_t DELETED = 0xFE;
 
-/**
- * @brief Count frequency of elements in array
- * @param arr Input array
- * @return Hash table with element frequencies
- */
-template <typename T>
-HashTable<T, int> count_frequencies(const std::vector<T>& arr) {
-    HashTable<T, int> freq_table;
+#if defined(HASH_TABLE_USE_SSE2)
+    __m128i ctrl;
 
-    for (const T& element : arr) {
-        if (freq_table.contains(element)) {
-            freq_table.get(element)++;
-        } else {
-            freq_table.insert(element, 1);
-        }
+    explicit ControlGroup(const uint8_t* pos)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos))) {}
+
+    uint32_t match(uint8_t h2) const {
+        return static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(h2)))));
     }
 
-    return freq_table;
-}
+    uint32_t match_empty() const {
+        return match(EMPTY);
+    }
 
-/**
- * @brief Find first non-repeating character in string
- * @param str Input string
- * @return First non-repeating character, or '\0' if none
- */
-char first_non_repeating_char(const std::string& str) {
-    HashTable<char, int> count_table;
+    uint32_t match_empty_or_deleted() const {
+        // EMPTY and DELETED are the only control bytes with the high bit set
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+    }
+#elif defined(HASH_TABLE_USE_NEON)
+    uint8x16_t ctrl;
 
-    // Count occurrences
-    for (char ch : str) {
-        if (count_table.contains(ch)) {
-            count_table.get(ch)++;
-        } else {
-            count_table.insert(ch, 1);
-        }
+    explicit ControlGroup(const uint8_t* pos) : ctrl(vld1q_u8(pos)) {}
+
+    static uint32_t to_bitmask(uint8x16_t lanes) {
+        static const uint8_t lane_bits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                              1, 2, 4, 8, 16, 32, 64, 128};
+        uint8x16_t bits = vandq_u8(lanes, vld1q_u8(lane_bits));
+        return static_cast<uint32_t>(vaddv_u8(vget_low_u8(bits))) |
+               (static_cast<uint32_t>(vaddv_u8(vget_high_u8(bits))) << 8);
     }
 
-    // Find first character with count 1
-    for (char ch : str) {
-        if (count_table.get(ch) == 1) {
-            return ch;
-        }
+    uint32_t match(uint8_t h2) const {
+        return to_bitmask(vceqq_u8(ctrl, vdupq_n_u8(h2)));
     }
 
-    return '\0';  // No non-repeating character
-}
+    uint32_t match_empty() const {
+        return match(EMPTY);
+    }
 
-/**
- * @brief Check if two strings are anagrams
- * @param str1 First string
- * @param str2 Second string
- * @return true if strings are anagrams
- */
-bool are_anagrams(const std::string& str1, const std::string& str2) {
-    if (str1.length() != str2.length()) {
-        return false;
+    uint32_t match_empty_or_deleted() const {
+        return to_bitmask(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
     }
+#else
+    uint8_t ctrl[WIDTH];
 
-    HashTable<char, int> count_table;
+    explicit ControlGroup(const uint8_t* pos) {
+        for (size_t i = 0; i < WIDTH; ++i) {
+            ctrl[i] = pos[i];
+        }
+    }
 
-    // Count characters in first string
-    for (char ch : str1) {
-        if (count_table.contains(ch)) {
-            count_table.get(ch)++;
-        } else {
-            count_table.insert(ch, 1);
+    uint32_t match(uint8_t h2) const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < WIDTH; ++i) {
+            if (ctrl[i] == h2) {
+                mask |= 1u << i;
+            }
         }
+        return mask;
     }
 
-    // Subtract characters from second string
-    for (char ch : str2) {
-        if (count_table.contains(ch)) {
-            count_table.get(ch)--;
-            if (count_table.get(ch) == 0) {
-                count_table.remove(ch);
+    uint32_t match_empty() const {
+        return match(EMPTY);
+    }
+
+    uint32_t match_empty_or_deleted() const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < WIDTH; ++i) {
+            if (ctrl[i] & 0x80) {
+                mask |= 1u << i;
             }
-        } else {
-            return false;  // Character not found
         }
+        return mask;
     }
+#endif
 
-    return count_table.is_empty();
-}
\ No newline at end of file
+    /**
+     * @brief Index of the lowest set bit of a non-zero match mask
+     */
+    static size_t lowest_bit(uint32_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctz(mask));
+#else
+        size_t index = 0;
+        while ((mask & 1u) == 0) {
+            mask >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+};
+
+/**
+ * @brief Hash Table with Grouped Metadata (Swiss Table)
+ *
+ * Drop-in alternative to OpenAddressingHashTable (same insert/remove/
+ * contains/get API) that keeps the probing metadata apart from the entries:
+ * - One control byte per slot, stored contiguously, so a probe touches one
+ *   16-byte cache-resident group instead of 16 fat Entry objects
+ * - 16 slots are matched at once against 7 bits of the hash, so the key
+ *   comparison only runs for likely candidates
+ * - Capacity is a power of two, so indexing uses a mask instead of modulo
+ * - Groups are probed quadratically (triangular numbers), which visits every
+ *   group exactly once
+ *
+ * Tombstones are handled in two ways:
+ * - remove() writes EMPTY instead of DELETED when the slot's group still has
+ *   an EMPTY slot, because no probe sequence can continue past such a group
+ * - When the table runs out of room but is mostly tombstones, the entries
+ *   are rearranged in place at the same capacity instead of doubling
+ *
+ * Time Complexity (Average Case):
+ * - Insert: O(1)
+ * - Delete: O(1)
+ * - Search: O(1)
+ *
+ * Like OpenAddressingHashTable, K and V must be default constructible.
+ */
+template <typename K, typename V>
+class SwissHashTable {
+private:
+    struct Slot {
+        K key;
+        V value;
+    };
+
+    std::vector<uint8_t> ctrl;   // One control byte per slot
+    std::vector<Slot> slots;     // Keys and values, indexed like ctrl
+    size_t num_elements;         // Number of occupied slots
+    size_t num_buckets;          // Total number of slots (power of two)
+    size_t growth_left;          // Inserts into EMPTY slots before a resize
+
+    /**
+     * @brief Hash a key and scramble the bits
+     *
+     * std::hash is the identity for integers on common standard libraries,
+     * which would put sequential keys in the same H2 class. A multiplicative
+     * mix spreads them across both H1 (position) and H2 (control byte).
+     */
+    static uint64_t hash(const K& key) {
+        uint64_t h = static_cast<uint64_t>(std::hash<K>{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static size_t h1(uint64_t h) { return static_cast<size_t>(h >> 7); }
+    static uint8_t h2(uint64_t h) { return static_cast<uint8_t>(h & 0x7F); }
+
+    size_t num_groups() const { return num_buckets / ControlGroup::WIDTH; }
+
+    /**
+     * @brief Maximum number of elements and tombstones (7/8 load)
+     */
+    static size_t capacity_to_growth(size_t capacity) {
+        return capacity - capacity / 8;
+    }
+
+    static size_t normalize_capacity(size_t requested) {
+        size_t capacity = ControlGroup::WIDTH;
+        while (capacity < requested) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    void init_storage(size_t capacity) {
+        num_buckets = capacity;
+        ctrl.assign(num_buckets, ControlGroup::EMPTY);
+        slots.clear();
+        slots.resize(num_buckets);
+        num_elements = 0;
+        growth_left = capacity_to_growth(num_buckets);
+    }
+
+    /**
+     * @brief Locate the slot holding key
+     * @return Slot index, or num_buckets if the key is absent
+     */
+    size_t find_index(const K& key) const {
+        uint64_t h = hash(key);
+        uint8_t tag = h2(h);
+        size_t group_mask = num_groups() - 1;
+        size_t group = h1(h) & group_mask;
+
+        for (size_t step = 1; step <= num_groups(); ++step) {
+            size_t base = group * ControlGroup::WIDTH;
+            ControlGroup g(&ctrl[base]);
+
+            for (uint32_t mask = g.match(tag); mask != 0; mask &= mask - 1) {
+                size_t index = base + ControlGroup::lowest_bit(mask);
+                if (slots[index].key == key) {
+                    return index;
+                }
+            }
+
+            // An EMPTY slot ends every probe sequence that reaches it
+            if (g.match_empty() != 0) {
+                break;
+            }
+            group = (group + step) & group_mask;
+        }
+
+        return num_buckets;
+    }
+
+    /**
+     * @brief First EMPTY or DELETED slot on the probe sequence of a hash
+     */
+    size_t find_first_non_full(uint64_t h) const {
+        size_t group_mask = num_groups() - 1;
+        size_t group = h1(h) & group_mask;
+
+        for (size_t step = 1;; ++step) {
+            size_t base = group * ControlGroup::WIDTH;
+            uint32_t mask = ControlGroup(&ctrl[base]).match_empty_or_deleted();
+            if (mask != 0) {
+                return base + ControlGroup::lowest_bit(mask);
+            }
+            group = (group + step) & group_mask;
+        }
+    }
+
+    /**
+     * @brief Grow the table, or clean up tombstones if that frees enough room
+     */
+    void make_room() {
+        if (num_elements <= capacity_to_growth(num_buckets) / 2) {
+            drop_deletes_without_resize();
+        } else {
+            rehash(num_buckets * 2);
+        }
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<uint8_t> old_ctrl = std::move(ctrl);
+        std::vector<Slot> old_slots = std::move(slots);
+
+        init_storage(new_capacity);
+
+        for (size_t i = 0; i < old_ctrl.size(); ++i) {
+            if ((old_ctrl[i] & 0x80) == 0) {
+                uint64_t h = hash(old_slots[i].key);
+                size_t index = find_first_non_full(h);
+                ctrl[index] = h2(h);
+                slots[index] = std::move(old_slots[i]);
+                num_elements++;
+                growth_left--;
+            }
+        }
+    }
+
+    /**
+     * @brief Remove all tombstones in place without changing capacity
+     *
+     * Every DELETED slot becomes EMPTY and every occupied slot is marked
+     * DELETED (meaning "not yet placed"). Each not-yet-placed entry is then
+     * moved to the first free slot of its probe sequence. If that lands in
+     * its own group it stays put; if the target was still waiting to be
+     * placed, the two are swapped and the displaced entry is processed next.
+     */
+    void drop_deletes_without_resize() {
+        for (size_t i = 0; i < num_buckets; ++i) {
+            ctrl[i] = (ctrl[i] == ControlGroup::DELETED) ? ControlGroup::EMPTY
+                    : (ctrl[i] & 0x80) ? ctrl[i]
+                    : ControlGroup::DELETED;
+        }
+
+        for (size_t i = 0; i < num_buckets; ++i) {
+            if (ctrl[i] != ControlGroup::DELETED) {
+                continue;
+            }
+
+            uint64_t h = hash(slots[i].key);
+            size_t target = find_first_non_full(h);
+
+            if (target / ControlGroup::WIDTH == i / ControlGroup::WIDTH) {
+                ctrl[i] = h2(h);
+                continue;
+            }
+
+            if (ctrl[target] == ControlGroup::EMPTY) {
+                slots[target] = std::move(slots[i]);
+                slots[i] = Slot{};
+                ctrl[target] = h2(h);
+                ctrl[i] = ControlGroup::EMPTY;
+            } else {
+                std::swap(slots[i], slots[target]);
+                ctrl[target] = h2(h);
+                --i;  // Re-process the entry that was swapped into slot i
+            }
+        }
+
+        growth_left = capacity_to_growth(num_buckets) - num_elements;
+    }
+
+public:
+    SwissHashTable(size_t initial_size = 16) {
+        init_storage(normalize_capacity(initial_size));
+    }
+
+    bool insert(const K& key, const V& value) {
+        size_t existing = find_index(key);
+        if (existing != num_buckets) {
+            slots[existing].value = value;  // Update existing
+            return true;
+        }
+
+        uint64_t h = hash(key);
+        size_t index = find_first_non_full(h);
+
+        // Reusing a tombstone does not consume growth; filling an EMPTY does
+        if (growth_left == 0 && ctrl[index] == ControlGroup::EMPTY) {
+            make_room();
+            index = find_first_non_full(h);
+        }
+
+        if (ctrl[index] == ControlGroup::EMPTY) {
+            growth_left--;
+        }
+        ctrl[index] = h2(h);
+        slots[index].key = key;
+        slots[index].value = value;
+        num_elements++;
+        return true;
+    }
+
+    bool remove(const K& key) {
+        size_t index = find_index(key);
+        if (index == num_buckets) {
+            return false;  // Key not found
+        }
+
+        size_t base = index - index % ControlGroup::WIDTH;
+        if (ControlGroup(&ctrl[base]).match_empty() != 0) {
+            // Lookups already stop in this group, so no tombstone is needed
+            ctrl[index] = ControlGroup::EMPTY;
+            growth_left++;
+        } else {
+            ctrl[index] = ControlGroup::DELETED;
+        }
+
+        slots[index] = Slot{};
+        num_elements--;
+        return true;
+    }
+
+    bool contains(const K& key) const {
+        return find_index(key) != num_buckets;
+    }
+
+    V& get(const K& key) {
+        size_t index = find_index(key);
+        if (index == num_buckets) {
+            throw std::out_of_range("Key not found");
+        }
+        return slots[index].value;
+    }
+
+    const V& get(const K& key) const {
+        size_t index = find_index(key);
+        if (index == num_buckets) {
+            throw std::out_of_range("Key not found");
+        }
+        return slots[index].value;
+    }
+
+    size_t size() const { return num_elements; }
+    bool is_empty() const { return num_elements == 0; }
+    size_t capacity() const { return num_buckets; }
+    double load_factor() const { return static_cast<double>(num_elements) / num_buckets; }
+
+    /**
+     * @brief Number of DELETED control bytes currently in the table
+     */
+    size_t tombstones() const {
+        return capacity_to_growth(num_buckets) - num_elements - growth_left;
+    }
+
+    /**
+     * @brief Probe-length histogram (in groups) and memory footprint
+     */
+    HashTableStats stats() const {
+        HashTableStats result;
+        result.size = num_elements;
+        result.buckets = num_buckets;
+        result.tombstones = tombstones();
+        result.load_factor = load_factor();
+        result.memory_bytes = ctrl.capacity() * sizeof(uint8_t) + slots.capacity() * sizeof(Slot);
+
+        size_t group_mask = num_groups() - 1;
+        size_t total_probes = 0;
+        for (size_t i = 0; i < num_buckets; ++i) {
+            if ((ctrl[i] & 0x80) != 0) {
+                continue;
+            }
+
+            // Replay the triangular probe sequence until it reaches slot i's group
+            size_t target = i / ControlGroup::WIDTH;
+            size_t group = h1(hash(slots[i].key)) & group_mask;
+            size_t probes = 1;
+            while (group != target) {
+                group = (group + probes) & group_mask;
+                probes++;
+            }
+            result.record(probes);
+            total_probes += probes;
+        }
+
+        if (num_elements > 0) {
+            result.mean_probe_length = static_cast<double>(total_probes) / num_elements;
+        }
+        return result;
+    }
+
+    void clear() {
+        init_storage(num_buckets);
+    }
+};
+
+/**
+ * @brief Thread-safe Hash Table with Sharded Locking
+ *
+ * Same separate-chaining layout as HashTable, but the key space is split
+ * into a power-of-two number of shards. Each shard has its own buckets,
+ * its own writer lock, and resizes on its own, so writers to different
+ * shards never contend.
+ *
+ * Readers never take a lock when K and V are trivially copyable:
+ * - Every shard carries a sequence counter that is odd while a writer is
+ *   modifying it (a seqlock)
+ * - A reader snapshots the counter, walks the chain, copies out the value,
+ *   and retries if the counter changed in the meantime
+ * - Nodes are recycled through a per-shard free list and never returned
+ *   to the heap, and bucket arrays replaced by a resize are retired rather
+ *   than freed, so a reader racing a writer only ever sees stale bytes in
+ *   valid memory, which the sequence check then discards
+ * - Node fields are held in relaxed atomic words, so the racing copy is
+ *   not a data race either: the reader may see torn bytes, never UB
+ * Other key/value types (e.g. std::string) could point to freed memory
+ * mid-update, so their readers fall back to a shared (reader) lock and
+ * their fields are stored plainly.
+ *
+ * Time Complexity (Average Case):
+ * - Insert: O(1)
+ * - Delete: O(1)
+ * - Search: O(1), lock-free for trivially copyable K and V
+ *
+ * Values are returned by copy, since a reference into the table could be
+ * invalidated by another thread at any time.
+ */
+template <typename K, typename V>
+class ConcurrentHashTable {
+private:
+    static constexpr bool lock_free_reads =
+        std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value;
+
+    // Node field only touched under the shard lock
+    template <typename T, bool Racy = lock_free_reads>
+    struct Cell {
+        T item;
+
+        Cell() : item() {}
+        void store(const T& v) { item = v; }
+        const T& load() const { return item; }
+    };
+
+    // Node field copied by seqlock readers while a writer may store it:
+    // the bytes live in relaxed atomic words, so the copy is race-free
+    template <typename T>
+    struct Cell<T, true> {
+        static constexpr size_t words = (sizeof(T) + sizeof(uintptr_t) - 1) / sizeof(uintptr_t);
+        std::atomic<uintptr_t> bits[words];
+
+        Cell() { store(T()); }
+
+        void store(const T& v) {
+            uintptr_t buffer[words] = {};
+            std::memcpy(buffer, &v, sizeof(T));
+            for (size_t i = 0; i < words; ++i) {
+                bits[i].store(buffer[i], std::memory_order_relaxed);
+            }
+        }
+
+        T load() const {
+            uintptr_t buffer[words];
+            for (size_t i = 0; i < words; ++i) {
+                buffer[i] = bits[i].load(std::memory_order_relaxed);
+            }
+            T v;
+            std::memcpy(&v, buffer, sizeof(T));
+            return v;
+        }
+    };
+
+    struct Node {
+        Cell<K> key;
+        Cell<V> value;
+        std::atomic<size_t> hash;
+        std::atomic<Node*> next;
+
+        Node() : hash(0), next(nullptr) {}
+    };
+
+    struct BucketArray {
+        size_t count;
+        std::unique_ptr<std::atomic<Node*>[]> heads;
+
+        explicit BucketArray(size_t n) : count(n), heads(new std::atomic<Node*>[n]) {
+            for (size_t i = 0; i < n; ++i) {
+                heads[i].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    // Padded to a cache line so that shards do not false-share
+    struct alignas(64) Shard {
+        mutable std::shared_mutex lock;                       // Held by writers (and non-seqlock readers)
+        std::atomic<uint64_t> sequence{0};                    // Odd while a write is in progress
+        std::atomic<BucketArray*> table{nullptr};             // Current bucket array
+        std::atomic<size_t> num_elements{0};                  // Number of stored elements
+        std::atomic<size_t> node_capacity{0};                 // Nodes ever allocated (bounds chain walks)
+        std::vector<std::unique_ptr<BucketArray>> tables;     // Current and retired bucket arrays
+        std::vector<std::unique_ptr<Node[]>> slabs;           // Node storage, never freed while alive
+        Node* free_list = nullptr;                            // Recycled nodes
+    };
+
+    std::unique_ptr<Shard[]> shards;
+    size_t num_shards;
+    size_t shard_shift;                   // Top hash bits select the shard
+    const double max_load_factor = 0.75;  // Per-shard load factor before resizing
+
+    static size_t hash(const K& key) {
+        uint64_t h = static_cast<uint64_t>(std::hash<K>{}(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h);
+    }
+
+    size_t shard_index(size_t h) const {
+        return num_shards == 1 ? 0 : h >> shard_shift;
+    }
+
+    /**
+     * @brief RAII guard that marks a shard as being written
+     *
+     * Takes the exclusive lock and makes the sequence odd for the lifetime
+     * of the guard, so optimistic readers retry.
+     */
+    class WriteGuard {
+    private:
+        Shard& shard;
+        std::unique_lock<std::shared_mutex> guard;
+
+    public:
+        explicit WriteGuard(Shard& s) : shard(s), guard(s.lock) {
+            shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1,
+                                 std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+        }
+
+        ~WriteGuard() {
+            shard.sequence.store(shard.sequence.load(std::memory_order_relaxed) + 1,
+                                 std::memory_order_release);
+        }
+    };
+
+    static Node* allocate_node(Shard& shard) {
+        if (shard.free_list == nullptr) {
+            size_t slab_size = std::max<size_t>(16, shard.node_capacity.load(std::memory_order_relaxed));
+            shard.slabs.emplace_back(new Node[slab_size]);
+            Node* slab = shard.slabs.back().get();
+            for (size_t i = 0; i < slab_size; ++i) {
+                slab[i].next.store(shard.free_list, std::memory_order_relaxed);
+                shard.free_list = &slab[i];
+            }
+            shard.node_capacity.fetch_add(slab_size, std::memory_order_relaxed);
+        }
+
+        Node* node = shard.free_list;
+        shard.free_list = node->next.load(std::memory_order_relaxed);
+        return node;
+    }
+
+    static void release_node(Shard& shard, Node* node) {
+        if constexpr (!lock_free_reads) {
+            // Only reached under the exclusive lock, so resources can be freed
+            node->key.store(K{});
+            node->value.store(V{});
+        }
+        node->next.store(shard.free_list, std::memory_order_relaxed);
+        shard.free_list = node;
+    }
+
+    /**
+     * @brief Double a shard's bucket array (caller holds the write guard)
+     */
+    void grow(Shard& shard) {
+        BucketArray* old_table = shard.table.load(std::memory_order_relaxed);
+        shard.tables.emplace_back(new BucketArray(old_table->count * 2));
+        BucketArray* new_table = shard.tables.back().get();
+
+        for (size_t i = 0; i < old_table->count; ++i) {
+            Node* node = old_table->heads[i].load(std::memory_order_relaxed);
+            while (node != nullptr) {
+                Node* next = node->next.load(std::memory_order_relaxed);
+                auto& head = new_table->heads[node->hash.load(std::memory_order_relaxed) % new_table->count];
+                node->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                head.store(node, std::memory_order_relaxed);
+                node = next;
+            }
+        }
+
+        // The old array stays allocated (in tables) for readers already
+        // walking it; retired arrays add up to less than the live one.
+        shard.table.store(new_table, std::memory_order_release);
+    }
+
+    static Node* find_locked(const Shard& shard, const K& key, size_t h) {
+        BucketArray* table = shard.table.load(std::memory_order_relaxed);
+        Node* node = table->heads[h % table->count].load(std::memory_order_relaxed);
+        while (node != nullptr) {
+            if (node->hash.load(std::memory_order_relaxed) == h && node->key.load() == key) {
+                return node;
+            }
+            node = node->next.load(std::memory_order_relaxed);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Insert or update a key in a shard (caller holds the write guard)
+     */
+    void insert_locked(Shard& shard, const K& key, const V& value, size_t h) {
+        Node* existing = find_locked(shard, key, h);
+        if (existing != nullptr) {
+            existing->value.store(value);
+            return;
+        }
+
+        BucketArray* table = shard.table.load(std::memory_order_relaxed);
+        size_t count = shard.num_elements.load(std::memory_order_relaxed);
+        if (static_cast<double>(count + 1) / table->count > max_load_factor) {
+            grow(shard);
+            table = shard.table.load(std::memory_order_relaxed);
+        }
+
+        Node* node = allocate_node(shard);
+        node->key.store(key);
+        node->value.store(value);
+        node->hash.store(h, std::memory_order_relaxed);
+
+        auto& head = table->heads[h % table->count];
+        node->next.store(head.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        head.store(node, std::memory_order_release);
+        shard.num_elements.store(count + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Look up a key in a shard without taking its lock
+     *
+     * Standard seqlock read: the result is only trusted if the sequence was
+     * even and unchanged across the whole walk.
+     */
+    static bool find_optimistic(const Shard& shard, const K& key, size_t h, V& out) {
+        for (;;) {
+            uint64_t before = shard.sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            bool found = false;
+            BucketArray* table = shard.table.load(std::memory_order_acquire);
+            Node* node = table->heads[h % table->count].load(std::memory_order_acquire);
+
+            // A chain can never be longer than the number of nodes, so a
+            // longer walk means a concurrent writer relinked it
+            size_t steps_left = shard.node_capacity.load(std::memory_order_relaxed);
+            while (node != nullptr && steps_left-- > 0) {
+                if (node->hash.load(std::memory_order_relaxed) == h && node->key.load() == key) {
+                    out = node->value.load();
+                    found = true;
+                    break;
+                }
+                node = node->next.load(std::memory_order_acquire);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.sequence.load(std::memory_order_relaxed) == before) {
+                return found;
+            }
+        }
+    }
+
+    bool find(const Shard& shard, const K& key, size_t h, V& out) const {
+        if constexpr (lock_free_reads) {
+            return find_optimistic(shard, key, h, out);
+        } else {
+            std::shared_lock<std::shared_mutex> guard(shard.lock);
+            Node* node = find_locked(shard, key, h);
+            if (node == nullptr) {
+                return false;
+            }
+            out = node->value.load();
+            return true;
+        }
+    }
+
+    /**
+     * @brief Group item indices by shard (counting sort on the shard index)
+     * @param hashes Hash of every item in the batch
+     * @param offsets Output: items of shard s are order[offsets[s]..offsets[s+1])
+     * @param order Output: item indices ordered by shard
+     */
+    void group_by_shard(const std::vector<size_t>& hashes, std::vector<size_t>& offsets,
+                        std::vector<size_t>& order) const {
+        offsets.assign(num_shards + 1, 0);
+        for (size_t h : hashes) {
+            offsets[shard_index(h) + 1]++;
+        }
+        for (size_t s = 0; s < num_shards; ++s) {
+            offsets[s + 1] += offsets[s];
+        }
+
+        std::vector<size_t> cursor(offsets.begin(), offsets.end() - 1);
+        order.resize(hashes.size());
+        for (size_t i = 0; i < hashes.size(); ++i) {
+            order[cursor[shard_index(hashes[i])]++] = i;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param shard_count Number of independently locked shards (rounded up
+     *        to a power of two); a few times the thread count works well
+     * @param buckets_per_shard Initial number of buckets in each shard
+     */
+    ConcurrentHashTable(size_t shard_count = 64, size_t buckets_per_shard = 16)
+        : num_shards(1), shard_shift(0) {
+        size_t bits = 0;
+        while (num_shards < shard_count) {
+            num_shards *= 2;
+            bits++;
+        }
+        shard_shift = sizeof(size_t) * 8 - bits;
+
+        shards.reset(new Shard[num_shards]);
+        for (size_t s = 0; s < num_shards; ++s) {
+            shards[s].tables.emplace_back(new BucketArray(std::max<size_t>(1, buckets_per_shard)));
+            shards[s].table.store(shards[s].tables.back().get(), std::memory_order_relaxed);
+        }
+    }
+
+    ConcurrentHashTable(const ConcurrentHashTable&) = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+    /**
+     * @brief Insert or update key-value pair
+     */
+    void insert(const K& key, const V& value) {
+        size_t h = hash(key);
+        Shard& shard = shards[shard_index(h)];
+        WriteGuard guard(shard);
+        insert_locked(shard, key, value, h);
+    }
+
+    /**
+     * @brief Remove key-value pair
+     * @return true if key was removed, false if key didn't exist
+     */
+    bool remove(const K& key) {
+        size_t h = hash(key);
+        Shard& shard = shards[shard_index(h)];
+        WriteGuard guard(shard);
+
+        BucketArray* table = shard.table.load(std::memory_order_relaxed);
+        std::atomic<Node*>* link = &table->heads[h % table->count];
+        Node* node = link->load(std::memory_order_relaxed);
+
+        while (node != nullptr) {
+            if (node->hash.load(std::memory_order_relaxed) == h && node->key.load() == key) {
+                link->store(node->next.load(std::memory_order_relaxed), std::memory_order_release);
+                release_node(shard, node);
+                shard.num_elements.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+            link = &node->next;
+            node = link->load(std::memory_order_relaxed);
+        }
+
+        return false;  // Key not found
+    }
+
+    /**
+     * @brief Copy the value for key into out
+     * @return true if key was found
+     */
+    bool try_get(const K& key, V& out) const {
+        size_t h = hash(key);
+        return find(shards[shard_index(h)], key, h, out);
+    }
+
+    /**
+     * @brief Get a copy of the value associated with key
+     */
+    V get(const K& key) const {
+        V value{};
+        if (!try_get(key, value)) {
+            throw std::out_of_range("Key not found in hash table");
+        }
+        return value;
+    }
+
+    bool contains(const K& key) const {
+        V ignored{};
+        return try_get(key, ignored);
+    }
+
+    /**
+     * @brief Insert many pairs, taking each shard's lock once
+     */
+    void insert_many(const std::vector<std::pair<K, V>>& items) {
+        std::vector<size_t> hashes(items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            hashes[i] = hash(items[i].first);
+        }
+
+        std::vector<size_t> offsets, order;
+        group_by_shard(hashes, offsets, order);
+
+        for (size_t s = 0; s < num_shards; ++s) {
+            if (offsets[s] == offsets[s + 1]) {
+                continue;
+            }
+
+            WriteGuard guard(shards[s]);
+            for (size_t j = offsets[s]; j < offsets[s + 1]; ++j) {
+                const auto& item = items[order[j]];
+                insert_locked(shards[s], item.first, item.second, hashes[order[j]]);
+            }
+        }
+    }
+
+    /**
+     * @brief Look up many keys, visiting each shard once
+     * @return One entry per key, empty when the key is absent
+     */
+    std::vector<std::optional<V>> get_many(const std::vector<K>& keys) const {
+        std::vector<size_t> hashes(keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            hashes[i] = hash(keys[i]);
+        }
+
+        std::vector<size_t> offsets, order;
+        group_by_shard(hashes, offsets, order);
+
+        std::vector<std::optional<V>> results(keys.size());
+        for (size_t s = 0; s < num_shards; ++s) {
+            const Shard& shard = shards[s];
+            if (offsets[s] == offsets[s + 1]) {
+                continue;
+            }
+
+            std::shared_lock<std::shared_mutex> guard;
+            if (!lock_free_reads) {
+                guard = std::shared_lock<std::shared_mutex>(shard.lock);
+            }
+
+            for (size_t j = offsets[s]; j < offsets[s + 1]; ++j) {
+                size_t i = order[j];
+                V value{};
+                bool found;
+                if constexpr (lock_free_reads) {
+                    found = find_optimistic(shard, keys[i], hashes[i], value);
+                } else {
+                    Node* node = find_locked(shard, keys[i], hashes[i]);
+                    found = node != nullptr;
+                    if (found) {
+                        value = node->value.load();
+                    }
+                }
+                if (found) {
+                    results[i] = std::move(value);
+                }
+            }
+        }
+
+        return results;
+    }
+
+    /**
+     * @brief Number of stored elements (a snapshot under concurrent writes)
+     */
+    size_t size() const {
+        size_t total = 0;
+        for (size_t s = 0; s < num_shards; ++s) {
+            total += shards[s].num_elements.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    bool is_empty() const { return size() == 0; }
+    size_t shard_count() const { return num_shards; }
+
+    /**
+     * @brief Remove all elements; bucket arrays and nodes are kept for reuse
+     */
+    void clear() {
+        for (size_t s = 0; s < num_shards; ++s) {
+            Shard& shard = shards[s];
+            WriteGuard guard(shard);
+
+            BucketArray* table = shard.table.load(std::memory_order_relaxed);
+            for (size_t i = 0; i < table->count; ++i) {
+                Node* node = table->heads[i].load(std::memory_order_relaxed);
+                table->heads[i].store(nullptr, std::memory_order_release);
+                while (node != nullptr) {
+                    Node* next = node->next.load(std::memory_order_relaxed);
+                    release_node(shard, node);
+                    node = next;
+                }
+            }
+            shard.num_elements.store(0, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * @brief Hash Table Applications and Examples
+ */
+
+/**
+ * @brief Count frequency of elements in array
+ * @param arr Input array
+ * @return Hash table with element frequencies
+ */
+template <typename T>
+HashTable<T, int> count_frequencies(const std::vector<T>& arr) {
+    HashTable<T, int> freq_table;
+
+    for (const T& element : arr) {
+        if (freq_table.contains(element)) {
+            freq_table.get(element)++;
+        } else {
+            freq_table.insert(element, 1);
+        }
+    }
+
+    return freq_table;
+}
+
+/**
+ * @brief Find first non-repeating character in string
+ * @param str Input string
+ * @return First non-repeating character, or '\0' if none
+ */
+char first_non_repeating_char(const std::string& str) {
+    HashTable<char, int> count_table;
+
+    // Count occurrences
+    for (char ch : str) {
+        if (count_table.contains(ch)) {
+            count_table.get(ch)++;
+        } else {
+            count_table.insert(ch, 1);
+        }
+    }
+
+    // Find first character with count 1
+    for (char ch : str) {
+        if (count_table.get(ch) == 1) {
+            return ch;
+        }
+    }
+
+    return '\0';  // No non-repeating character
+}
+
+/**
+ * @brief Check if two strings are anagrams
+ * @param str1 First string
+ * @param str2 Second string
+ * @return true if strings are anagrams
+ */
+bool are_anagrams(const std::string& str1, const std::string& str2) {
+    if (str1.length() != str2.length()) {
+        return false;
+    }
+
+    HashTable<char, int> count_table;
+
+    // Count characters in first string
+    for (char ch : str1) {
+        if (count_table.contains(ch)) {
+            count_table.get(ch)++;
+        } else {
+            count_table.insert(ch, 1);
+        }
+    }
+
+    // Subtract characters from second string
+    for (char ch : str2) {
+        if (count_table.contains(ch)) {
+            count_table.get(ch)--;
+            if (count_table.get(ch) == 0) {
+                count_table.remove(ch);
+            }
+        } else {
+            return false;  // Character not found
+        }
+    }
+
+    return count_table.is_empty();
+}
+/**
+ * @brief Hash Table Benchmark Harness
+ *
+ * Measures HashTable, OpenAddressingHashTable, SwissHashTable and
+ * std::unordered_map on the same keys and reports, per configuration:
+ * - ns/op for inserts and for lookups at each hit ratio
+ * - table memory per entry (see HashTableStats::memory_bytes)
+ * - mean/max probe length and, optionally, the full stats() histogram
+ *
+ * The sweep covers:
+ * - key type: int, short string (8 chars, fits std::string's inline buffer)
+ *   and long string (40 chars with a shared 32-char prefix, heap allocated
+ *   and expensive to compare)
+ * - table size: working sets from min_working_set (L1-resident) growing 8x
+ *   per step up to max_llc_multiple times the last-level cache
+ * - load factor: each table is pre-sized to initial_buckets = n / load, so
+ *   it holds n entries at that load without resizing (SwissHashTable rounds
+ *   up to a power of two; stats() reports the load actually reached)
+ * - hit ratio: lookups draw from the inserted keys with that probability
+ *   and from a disjoint set of never-inserted keys otherwise
+ */
+struct HashBenchmarkConfig {
+    std::vector<double> load_factors = {0.25, 0.5, 0.7};
+    std::vector<double> hit_ratios = {1.0, 0.5, 0.0};
+    size_t min_working_set = 16 * 1024;  // Bytes of key/value payload
+    size_t max_llc_multiple = 10;        // Largest working set, in multiples of the LLC
+    size_t lookups = 1 << 20;            // Lookups per measurement
+    bool string_keys = true;             // Also run the short/long string sweeps
+    bool print_histograms = false;
+};
+
+/**
+ * @brief Size of the last-level cache, or 32 MB if it cannot be queried
+ */
+size_t last_level_cache_bytes() {
+#if defined(__linux__) && defined(_SC_LEVEL3_CACHE_SIZE)
+    long l3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+    if (l3 > 0) {
+        return static_cast<size_t>(l3);
+    }
+    long l2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (l2 > 0) {
+        return static_cast<size_t>(l2);
+    }
+#endif
+    return 32 * 1024 * 1024;
+}
+
+/**
+ * @brief Bijective 32-bit mixer (MurmurHash3 finalizer)
+ *
+ * Distinct inputs give distinct keys, so even indices produce the inserted
+ * keys and odd indices produce keys that are guaranteed to miss.
+ */
+uint32_t benchmark_mix(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x85ebca6bU;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35U;
+    x ^= x >> 16;
+    return x;
+}
+
+struct IntBenchmarkKeys {
+    using Key = int;
+    static const char* name() { return "int"; }
+    static size_t payload_bytes() { return sizeof(int); }
+    static Key make(uint32_t i) { return static_cast<int>(benchmark_mix(i)); }
+};
+
+struct ShortStringBenchmarkKeys {
+    using Key = std::string;
+    static const char* name() { return "short string"; }
+    static size_t payload_bytes() { return sizeof(std::string); }
+    static Key make(uint32_t i) {
+        static const char digits[] = "0123456789abcdef";
+        uint32_t x = benchmark_mix(i);
+        std::string key(8, '0');
+        for (int d = 7; d >= 0; --d, x >>= 4) {
+            key[d] = digits[x & 0xF];
+        }
+        return key;
+    }
+};
+
+struct LongStringBenchmarkKeys {
+    using Key = std::string;
+    static const char* name() { return "long string"; }
+    static size_t payload_bytes() { return sizeof(std::string) + 41; }
+    static Key make(uint32_t i) {
+        return "com.example.service.session.key:" + ShortStringBenchmarkKeys::make(i);
+    }
+};
+
+template <typename Table, typename K>
+void benchmark_insert(Table& table, const K& key, uint64_t value) {
+    table.insert(key, value);
+}
+
+template <typename K>
+void benchmark_insert(std::unordered_map<K, uint64_t>& table, const K& key, uint64_t value) {
+    table.emplace(key, value);
+}
+
+template <typename Table, typename K>
+bool benchmark_contains(const Table& table, const K& key) {
+    return table.contains(key);
+}
+
+template <typename K>
+bool benchmark_contains(const std::unordered_map<K, uint64_t>& table, const K& key) {
+    return table.find(key) != table.end();
+}
+
+template <typename Table>
+HashTableStats benchmark_stats(const Table& table) {
+    return table.stats();
+}
+
+/**
+ * @brief Chain-length statistics for std::unordered_map
+ *
+ * Memory is an estimate: one pointer per bucket, and per node the pair,
+ * a next pointer and a cached hash (what libstdc++ stores for non-trivial
+ * hashes).
+ */
+template <typename K>
+HashTableStats benchmark_stats(const std::unordered_map<K, uint64_t>& table) {
+    HashTableStats result;
+    result.size = table.size();
+    result.buckets = table.bucket_count();
+    result.load_factor = table.load_factor();
+    result.memory_bytes = table.bucket_count() * sizeof(void*) +
+                          table.size() * (sizeof(std::pair<const K, uint64_t>) + sizeof(void*) + sizeof(size_t));
+
+    size_t comparisons = 0;
+    for (size_t i = 0; i < table.bucket_count(); ++i) {
+        size_t length = table.bucket_size(i);
+        result.record(length);
+        comparisons += length * (length + 1) / 2;
+    }
+    if (result.size > 0) {
+        result.mean_probe_length = static_cast<double>(comparisons) / result.size;
+    }
+    return result;
+}
+
+/**
+ * @brief Build one table, time inserts and lookups, and print one result row
+ */
+template <typename Table, typename K>
+void benchmark_hash_table(const char* name, double load, const std::vector<K>& keys,
+                          const std::vector<std::vector<K>>& lookup_sets,
+                          const HashBenchmarkConfig& config, uint64_t& checksum) {
+    size_t initial_buckets = std::max<size_t>(16, static_cast<size_t>(keys.size() / load));
+    Table table(initial_buckets);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < keys.size(); ++i) {
+        benchmark_insert(table, keys[i], static_cast<uint64_t>(i));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double insert_ns = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / keys.size();
+
+    HashTableStats stats = benchmark_stats(table);
+    std::cout << "  " << std::left << std::setw(18) << name << std::right
+              << std::fixed << std::setprecision(2) << std::setw(6) << stats.load_factor
+              << std::setprecision(1) << std::setw(10) << insert_ns;
+
+    for (const auto& lookups : lookup_sets) {
+        size_t found = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (const K& key : lookups) {
+            found += benchmark_contains(table, key) ? 1 : 0;
+        }
+        end = std::chrono::high_resolution_clock::now();
+        checksum += found;
+
+        double lookup_ns = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / lookups.size();
+        std::cout << std::setw(10) << lookup_ns;
+    }
+
+    std::cout << std::setw(10) << stats.bytes_per_entry()
+              << std::setprecision(2) << std::setw(8) << stats.mean_probe_length
+              << std::setw(6) << stats.max_probe_length << std::defaultfloat << std::endl;
+
+    if (config.print_histograms) {
+        stats.print();
+    }
+}
+
+/**
+ * @brief Run the full sweep for one key type
+ */
+template <typename KeyGen>
+void benchmark_hash_tables_for_keys(const HashBenchmarkConfig& config, size_t llc_bytes, uint64_t& checksum) {
+    using K = typename KeyGen::Key;
+    const size_t entry_bytes = KeyGen::payload_bytes() + sizeof(uint64_t);
+    const size_t max_working_set = llc_bytes * config.max_llc_multiple;
+
+    std::vector<size_t> working_sets;
+    for (size_t bytes = config.min_working_set; bytes < max_working_set; bytes *= 8) {
+        working_sets.push_back(bytes);
+    }
+    working_sets.push_back(max_working_set);
+
+    std::mt19937_64 rng(42);
+
+    for (size_t working_set : working_sets) {
+        size_t n = std::max<size_t>(1, working_set / entry_bytes);
+
+        std::vector<K> keys;
+        keys.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys.push_back(KeyGen::make(static_cast<uint32_t>(2 * i)));
+        }
+
+        // One lookup sequence per hit ratio, shared by every table
+        std::vector<std::vector<K>> lookup_sets;
+        for (double hit_ratio : config.hit_ratios) {
+            std::bernoulli_distribution hit(hit_ratio);
+            std::uniform_int_distribution<size_t> pick(0, n - 1);
+            std::vector<K> lookups;
+            lookups.reserve(config.lookups);
+            for (size_t i = 0; i < config.lookups; ++i) {
+                size_t index = pick(rng);
+                lookups.push_back(hit(rng) ? keys[index]
+                                           : KeyGen::make(static_cast<uint32_t>(2 * index + 1)));
+            }
+            lookup_sets.push_back(std::move(lookups));
+        }
+
+        std::cout << "\n[" << KeyGen::name() << " keys, " << n << " entries, "
+                  << working_set / 1024 << " KB payload]" << std::endl;
+        std::cout << "  " << std::left << std::setw(18) << "table" << std::right
+                  << std::setw(6) << "load" << std::setw(10) << "insert";
+        for (double hit_ratio : config.hit_ratios) {
+            std::cout << std::setw(6) << "hit" << std::setw(3) << static_cast<int>(hit_ratio * 100) << "%";
+        }
+        std::cout << std::setw(10) << "B/entry" << std::setw(8) << "probe" << std::setw(6) << "max"
+                  << std::endl;
+
+        for (double load : config.load_factors) {
+            benchmark_hash_table<HashTable<K, uint64_t>>("chaining", load, keys, lookup_sets, config, checksum);
+            benchmark_hash_table<OpenAddressingHashTable<K, uint64_t>>("linear probing", load, keys, lookup_sets, config, checksum);
+            benchmark_hash_table<SwissHashTable<K, uint64_t>>("swiss", load, keys, lookup_sets, config, checksum);
+            benchmark_hash_table<std::unordered_map<K, uint64_t>>("std::unordered_map", load, keys, lookup_sets, config, checksum);
+        }
+    }
+}
+
+/**
+ * @brief Benchmark every hash table layout across the configured sweep
+ *
+ * Times are per operation (ns/op); lookup columns follow config.hit_ratios.
+ * "probe" is HashTableStats::mean_probe_length and "max" the longest chain
+ * or probe sequence.
+ */
+void benchmark_hash_tables(const HashBenchmarkConfig& config = HashBenchmarkConfig()) {
+    size_t llc_bytes = last_level_cache_bytes();
+    uint64_t checksum = 0;
+
+    std::cout << "\n=== Hash Table Benchmark (LLC " << llc_bytes / 1024 << " KB) ===" << std::endl;
+    std::cout << "Columns: ns/op for insert and lookups, table bytes per entry, mean/max probe length" << std::endl;
+
+    benchmark_hash_tables_for_keys<IntBenchmarkKeys>(config, llc_bytes, checksum);
+    if (config.string_keys) {
+        benchmark_hash_tables_for_keys<ShortStringBenchmarkKeys>(config, llc_bytes, checksum);
+        benchmark_hash_tables_for_keys<LongStringBenchmarkKeys>(config, llc_bytes, checksum);
+    }
+
+    std::cout << "(checksum " << checksum << ")" << std::endl;
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Generic d-ary heap primitives
+ *
+ * Kept apart from the sort demos so that heap-based containers (the
+ * indexed PriorityQueue in Queues) can share them without pulling in the
+ * sorting files. Heap Sort builds its generic variants on top of these.
+ */
+
+/**
+ * @brief No-op callback for the generic heap primitives below
+ */
+struct NoHeapMoveCallback {
+    void operator()(size_t) const {}
+};
+
+/**
+ * @brief Generic iterative heapify (sift down) for a d-ary heap
+ *
+ * Same logic as heapify_iterative in Heap Sort, generalized in three ways:
+ * - Arity: children of node i are D*i + 1 ... D*i + D (D = 2 is the binary
+ *   heap; D = 4 halves the tree height and keeps siblings in one cache
+ *   line)
+ * - comp(a, b) returns true when a belongs *below* b, so std::less gives
+ *   a max heap like heapify() in Heap Sort and std::greater gives a min heap
+ * - The root element is held aside and children are moved up into the hole,
+ *   instead of swapping at every level
+ *
+ * on_move(pos) is called each time an element lands at index pos, which lets
+ * indexed heaps keep a handle -> position map up to date.
+ *
+ * @param arr Vector holding the heap
+ * @param n Size of heap
+ * @param i Root index of subtree
+ * @return Final index of the element that started at i
+ */
+template <size_t D, typename T, typename Compare, typename OnMove = NoHeapMoveCallback>
+size_t heapify_dary(std::vector<T>& arr, size_t n, size_t i, Compare comp,
+                    OnMove on_move = OnMove()) {
+    static_assert(D >= 2, "Heap arity must be at least 2");
+    T value = std::move(arr[i]);
+
+    while (true) {
+        size_t first_child = D * i + 1;
+        if (first_child >= n) {
+            break;
+        }
+
+        // Pick the child that belongs highest
+        size_t last_child = std::min(first_child + D, n);
+        size_t best = first_child;
+        for (size_t c = first_child + 1; c < last_child; ++c) {
+            if (comp(arr[best], arr[c])) {
+                best = c;
+            }
+        }
+
+        if (!comp(value, arr[best])) {
+            break;
+        }
+
+        arr[i] = std::move(arr[best]);
+        on_move(i);
+        i = best;
+    }
+
+    arr[i] = std::move(value);
+    on_move(i);
+    return i;
+}
+
+/**
+ * @brief Move the element at index i up until its parent belongs above it
+ * @return Final index of the element
+ */
+template <size_t D, typename T, typename Compare, typename OnMove = NoHeapMoveCallback>
+size_t heap_sift_up_dary(std::vector<T>& arr, size_t i, Compare comp,
+                         OnMove on_move = OnMove()) {
+    T value = std::move(arr[i]);
+
+    while (i > 0) {
+        size_t parent = (i - 1) / D;
+        if (!comp(arr[parent], value)) {
+            break;
+        }
+        arr[i] = std::move(arr[parent]);
+        on_move(i);
+        i = parent;
+    }
+
+    arr[i] = std::move(value);
+    on_move(i);
+    return i;
+}
+
+/**
+ * @brief Build a d-ary heap bottom-up in O(n) (Floyd's method)
+ *
+ * Same approach as build_heap_bottom_up in Heap Sort: heapify every
+ * non-leaf node, starting from the last one.
+ */
+template <size_t D, typename T, typename Compare, typename OnMove = NoHeapMoveCallback>
+void build_heap_dary(std::vector<T>& arr, Compare comp, OnMove on_move = OnMove()) {
+    size_t n = arr.size();
+    if (n < 2) {
+        for (size_t i = 0; i < n; ++i) {
+            on_move(i);
+        }
+        return;
+    }
+
+    // The loop below never starts a sift-down at a leaf, so report every
+    // leaf up front. Elements moved into a leaf later are reported by
+    // heapify_dary itself.
+    size_t first_leaf = (n - 2) / D + 1;
+    for (size_t i = first_leaf; i < n; ++i) {
+        on_move(i);
+    }
+
+    for (size_t i = first_leaf; i-- > 0;) {
+        heapify_dary<D>(arr, n, i, comp, on_move);
+    }
+}
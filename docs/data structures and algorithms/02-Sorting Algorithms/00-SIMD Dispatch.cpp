@@ -0,0 +1,98 @@
+#pragma once
+
+/**
+ * @brief Runtime instruction-set dispatch shared by the SIMD kernels
+ *
+ * The sorting networks and the SIMD linear scans both pick their kernels
+ * with active_simd_level(), so set_simd_level() forces every one of them
+ * down to the same level (handy for benchmarking the fallbacks). The
+ * kernels themselves are compiled with target attributes, so detection
+ * happens here at runtime and no -mavx2 flag is needed.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SIMD_DISPATCH_X86
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define SIMD_DISPATCH_NEON
+#endif
+
+// Wrap AVX-512 kernels in these. GCC 12 flags the _mm512_undefined_* placeholders
+// inside avx512fintrin.h as maybe-uninitialized once the kernels are inlined (a false positive).
+#if defined(__GNUC__) && !defined(__clang__)
+#define SIMD_AVX512_KERNELS_BEGIN \
+    _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+#define SIMD_AVX512_KERNELS_END _Pragma("GCC diagnostic pop")
+#else
+#define SIMD_AVX512_KERNELS_BEGIN
+#define SIMD_AVX512_KERNELS_END
+#endif
+
+/**
+ * @brief Instruction sets the kernels can run on, slowest first
+ */
+enum class SimdLevel {
+    Scalar,
+    Neon,
+    Avx2,
+    Avx512
+};
+
+const char* simd_level_name(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::Neon: return "neon";
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Avx512: return "avx512";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Best instruction set supported by this CPU (checked once)
+ */
+SimdLevel detect_simd_level() {
+    static const SimdLevel detected = [] {
+#if defined(SIMD_DISPATCH_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) return SimdLevel::Avx512;
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::Avx2;
+#elif defined(SIMD_DISPATCH_NEON)
+        return SimdLevel::Neon;
+#endif
+        return SimdLevel::Scalar;
+    }();
+    return detected;
+}
+
+namespace simd_dispatch_detail {
+
+inline SimdLevel& selected_level() {
+    static SimdLevel level = detect_simd_level();
+    return level;
+}
+
+}  // namespace simd_dispatch_detail
+
+/**
+ * @brief Instruction set used by the kernels
+ */
+SimdLevel active_simd_level() {
+    return simd_dispatch_detail::selected_level();
+}
+
+/**
+ * @brief Force a lower instruction set (for benchmarking the fallbacks)
+ *
+ * Requests above what the CPU supports are clamped to detect_simd_level().
+ * Not synchronized: call it before any kernel starts.
+ */
+void set_simd_level(SimdLevel level) {
+    SimdLevel best = detect_simd_level();
+    if (level > best) level = best;
+#if !defined(SIMD_DISPATCH_NEON)
+    if (level == SimdLevel::Neon) level = SimdLevel::Scalar;
+#endif
+    simd_dispatch_detail::selected_level() = level;
+}
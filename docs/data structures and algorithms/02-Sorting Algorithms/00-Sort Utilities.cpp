@@ -0,0 +1,50 @@
+#pragma once
+#include <functional>
+#include <utility>
+
+/**
+ * @brief Shared pieces for the iterator-based generic sorts
+ *
+ * The generic sorts in this directory take a half-open iterator range, a
+ * comparator and a projection, in that order:
+ *
+ *   insertion_sort_generic(people.begin(), people.end(), std::less<>(), &Person::age);
+ *
+ * The projection is applied to each element before it is compared, so
+ * sorting by a member or a computed key needs no hand-written comparator.
+ * It is called through std::invoke, so pointers to data members and
+ * member functions work as well as lambdas.
+ *
+ * The sorts only move and swap elements (never copy them), so they work
+ * for move-only types such as std::unique_ptr and don't deep-copy strings
+ * or large records.
+ */
+
+/**
+ * @brief Projection that returns its argument unchanged (std::identity in C++20)
+ */
+struct identity_projection {
+    template <typename T>
+    constexpr T&& operator()(T&& value) const noexcept {
+        return std::forward<T>(value);
+    }
+};
+
+/**
+ * @brief Comparator that compares proj(a) with proj(b)
+ */
+template <typename Compare, typename Projection>
+struct projected_compare {
+    Compare comp;
+    Projection proj;
+
+    template <typename A, typename B>
+    bool operator()(A&& a, B&& b) {
+        return std::invoke(comp, std::invoke(proj, std::forward<A>(a)), std::invoke(proj, std::forward<B>(b)));
+    }
+};
+
+template <typename Compare, typename Projection>
+projected_compare<Compare, Projection> make_projected_compare(Compare comp, Projection proj) {
+    return projected_compare<Compare, Projection>{std::move(comp), std::move(proj)};
+}
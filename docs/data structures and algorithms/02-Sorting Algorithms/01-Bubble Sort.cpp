@@ -1,6 +1,8 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include "00-Sort Utilities.cpp"
 
 /**
  * @brief Bubble Sort Implementation
@@ -133,6 +135,33 @@ void bubble_sort_recursive(std::vector<int>& arr, int n) {
     bubble_sort_recursive(arr, n - 1);
 }
 
+/**
+ * @brief Generic Bubble Sort over an iterator range
+ *
+ * Elements are only swapped, so move-only types work. Each pass stops at
+ * the last swap of the previous one, since everything after it is sorted.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void bubble_sort_generic(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    auto less = make_projected_compare(comp, proj);
+
+    while (last - first > 1) {
+        RandomIt last_swap = first;
+        for (RandomIt it = first; it + 1 != last; ++it) {
+            if (less(*(it + 1), *it)) {
+                std::iter_swap(it, it + 1);
+                last_swap = it + 1;
+            }
+        }
+        last = last_swap;
+    }
+}
+
 /**
  * @brief Generic Bubble Sort for any comparable type
  * @tparam T Type that supports comparison operators
@@ -141,19 +170,10 @@ void bubble_sort_recursive(std::vector<int>& arr, int n) {
  */
 template <typename T>
 void bubble_sort_generic(std::vector<T>& arr, bool ascending = true) {
-    int n = arr.size();
-    bool swapped;
-
-    for (int i = 0; i < n - 1; ++i) {
-        swapped = false;
-        for (int j = 0; j < n - i - 1; ++j) {
-            if ((ascending && arr[j] > arr[j + 1]) ||
-                (!ascending && arr[j] < arr[j + 1])) {
-                std::swap(arr[j], arr[j + 1]);
-                swapped = true;
-            }
-        }
-        if (!swapped) break;
+    if (ascending) {
+        bubble_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b > a; });
+    } else {
+        bubble_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b < a; });
     }
 }
 
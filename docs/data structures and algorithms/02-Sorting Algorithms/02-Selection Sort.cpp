@@ -1,6 +1,10 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include "00-Sort Utilities.cpp"
+#include "08-Selection.cpp"  // select_nth
 
 /**
  * @brief Selection Sort Implementation
@@ -176,6 +180,30 @@ int selection_sort_stable(std::vector<int>& arr) {
     return shifts;
 }
 
+/**
+ * @brief Generic Selection Sort over an iterator range
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void selection_sort_generic(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    auto less = make_projected_compare(comp, proj);
+
+    for (RandomIt i = first; last - i > 1; ++i) {
+        RandomIt min_it = i;
+        for (RandomIt j = i + 1; j != last; ++j) {
+            if (less(*j, *min_it)) {
+                min_it = j;
+            }
+        }
+        if (min_it != i) {
+            std::iter_swap(i, min_it);
+        }
+    }
+}
+
 /**
  * @brief Generic Selection Sort for any comparable type
  * @tparam T Type that supports comparison operators
@@ -184,21 +212,10 @@ int selection_sort_stable(std::vector<int>& arr) {
  */
 template <typename T>
 void selection_sort_generic(std::vector<T>& arr, bool ascending = true) {
-    int n = arr.size();
-
-    for (int i = 0; i < n - 1; ++i) {
-        int extreme_idx = i;  // min_idx for ascending, max_idx for descending
-
-        for (int j = i + 1; j < n; ++j) {
-            if ((ascending && arr[j] < arr[extreme_idx]) ||
-                (!ascending && arr[j] > arr[extreme_idx])) {
-                extreme_idx = j;
-            }
-        }
-
-        if (extreme_idx != i) {
-            std::swap(arr[i], arr[extreme_idx]);
-        }
+    if (ascending) {
+        selection_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return a < b; });
+    } else {
+        selection_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return a > b; });
     }
 }
 
@@ -295,28 +312,24 @@ void selection_sort_partial(std::vector<int>& arr, int k) {
 }
 
 /**
- * @brief Find kth smallest element using selection sort approach
+ * @brief Find kth smallest element
+ *
+ * Runs select_nth (introselect) on a copy: O(n) instead of the O(nk) of
+ * repeated minimum selection. selection_sort_partial is still the way to
+ * get the k smallest elements in place with selection sort itself.
+ *
  * @param arr Input vector
  * @param k Position (1-based) of element to find
  * @return kth smallest element
  */
-int find_kth_smallest(std::vector<int> arr, int k) {
+int find_kth_smallest(const std::vector<int>& arr, int k) {
     int n = arr.size();
     if (k <= 0 || k > n) {
         throw std::out_of_range("k is out of bounds");
     }
 
-    for (int i = 0; i < k; ++i) {
-        int min_idx = i;
-        for (int j = i + 1; j < n; ++j) {
-            if (arr[j] < arr[min_idx]) {
-                min_idx = j;
-            }
-        }
-        std::swap(arr[i], arr[min_idx]);
-    }
-
-    return arr[k - 1];
+    std::vector<int> copy = arr;
+    return select_nth(copy, k - 1);
 }
 
 /**
@@ -375,7 +388,7 @@ void test_selection_sort() {
 /**
  * @brief Performance comparison with other sorting algorithms
  */
-void compare_sorting_performance() {
+void compare_selection_sort_performance() {
     // Generate test data
     std::vector<int> test_data(1000);
     for (int i = 0; i < 1000; ++i) {
@@ -1,6 +1,9 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include "00-Sort Utilities.cpp"
 
 /**
  * @brief Insertion Sort Implementation
@@ -151,6 +154,38 @@ void insertion_sort_recursive(std::vector<int>& arr, int n) {
     arr[j + 1] = last;
 }
 
+/**
+ * @brief Generic Insertion Sort over an iterator range
+ *
+ * The key is moved out of the range and back in, and the elements in
+ * between are moved one slot up, so nothing is copied and move-only types
+ * work. Stable.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void insertion_sort_generic(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    if (first == last) return;
+    auto less = make_projected_compare(comp, proj);
+
+    for (RandomIt i = first + 1; i != last; ++i) {
+        if (!less(*i, *(i - 1))) {
+            continue;  // Already in place
+        }
+
+        typename std::iterator_traits<RandomIt>::value_type key = std::move(*i);
+        RandomIt j = i;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j != first && less(key, *(j - 1)));
+        *j = std::move(key);
+    }
+}
+
 /**
  * @brief Generic Insertion Sort for any comparable type
  * @tparam T Type that supports comparison operators
@@ -159,26 +194,10 @@ void insertion_sort_recursive(std::vector<int>& arr, int n) {
  */
 template <typename T>
 void insertion_sort_generic(std::vector<T>& arr, bool ascending = true) {
-    int n = arr.size();
-
-    for (int i = 1; i < n; ++i) {
-        T key = arr[i];
-        int j = i - 1;
-
-        // Move elements based on sort order
-        if (ascending) {
-            while (j >= 0 && arr[j] > key) {
-                arr[j + 1] = arr[j];
-                j--;
-            }
-        } else {
-            while (j >= 0 && arr[j] < key) {
-                arr[j + 1] = arr[j];
-                j--;
-            }
-        }
-
-        arr[j + 1] = key;
+    if (ascending) {
+        insertion_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b > a; });
+    } else {
+        insertion_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b < a; });
     }
 }
 
@@ -1,6 +1,27 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "00-Sort Utilities.cpp"  // identity_projection, make_projected_compare
+#include "10-Sorting Networks.cpp"  // sorting_network_sort, merge_sorted_blocks
 
 /**
  * @brief Merge Sort Implementation
@@ -198,18 +219,29 @@ void merge_sort_inplace(std::vector<int>& arr, int left, int right) {
 }
 
 /**
- * @brief Merge Sort with custom comparator
- * @tparam T Type that supports comparison
- * @tparam Compare Comparator function type
- * @param arr Vector to be sorted
- * @param comp Comparison function
+ * @brief Merge arr[left..mid] and arr[mid+1..right] through temp
+ *
+ * Takes from the left run unless the right element is strictly smaller,
+ * so with a strict comparator such as std::less the merge is stable.
  */
 template <typename T, typename Compare>
-void merge_sort_custom(std::vector<T>& arr, Compare comp) {
-    if (arr.size() <= 1) return;
+void merge_custom(std::vector<T>& arr, std::vector<T>& temp, int left, int mid, int right, Compare comp) {
+    int i = left, j = mid + 1, k = left;
+
+    while (i <= mid && j <= right) {
+        if (!comp(arr[j], arr[i])) {
+            temp[k++] = std::move(arr[i++]);
+        } else {
+            temp[k++] = std::move(arr[j++]);
+        }
+    }
+
+    while (i <= mid) temp[k++] = std::move(arr[i++]);
+    while (j <= right) temp[k++] = std::move(arr[j++]);
 
-    std::vector<T> temp(arr.size());
-    merge_sort_helper(arr, temp, 0, arr.size() - 1, comp);
+    for (i = left; i <= right; ++i) {
+        arr[i] = std::move(temp[i]);
+    }
 }
 
 template <typename T, typename Compare>
@@ -222,26 +254,312 @@ void merge_sort_helper(std::vector<T>& arr, std::vector<T>& temp, int left, int
     merge_custom(arr, temp, left, mid, right, comp);
 }
 
+namespace merge_detail {
+
+/**
+ * @brief Top-down merge sort of [first, last) using buffer for the left half
+ *
+ * The left run is moved out into buffer and merged back into place, so the
+ * buffer only ever holds n/2 elements and no element is copied or
+ * default-constructed. Runs that are already in order are not merged.
+ */
+template <typename RandomIt, typename Less, typename T>
+void merge_sort_range(RandomIt first, RandomIt last, Less& less, std::vector<T>& buffer) {
+    auto n = last - first;
+    if (n <= 1) return;
+
+    RandomIt mid = first + n / 2;
+    merge_sort_range(first, mid, less, buffer);
+    merge_sort_range(mid, last, less, buffer);
+
+    if (!less(*mid, *(mid - 1))) return;
+
+    buffer.clear();
+    for (RandomIt it = first; it != mid; ++it) {
+        buffer.emplace_back(std::move(*it));
+    }
+
+    auto left = buffer.begin();
+    RandomIt right = mid;
+    RandomIt out = first;
+    while (left != buffer.end() && right != last) {
+        // Take from the left run on ties to keep the sort stable
+        if (less(*right, *left)) {
+            *out++ = std::move(*right++);
+        } else {
+            *out++ = std::move(*left++);
+        }
+    }
+    std::move(left, buffer.end(), out);
+}
+
+} // namespace merge_detail
+
+/**
+ * @brief Stable Merge Sort over an iterator range
+ *
+ * Elements are only moved, so move-only types work.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void merge_sort_custom(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    auto n = last - first;
+    if (n <= 1) return;
+
+    auto less = make_projected_compare(comp, proj);
+    std::vector<T> buffer;
+    buffer.reserve(n / 2 + 1);
+    merge_detail::merge_sort_range(first, last, less, buffer);
+}
+
+/**
+ * @brief Merge Sort with custom comparator
+ * @tparam T Type that supports comparison
+ * @tparam Compare Comparator function type (strict weak ordering, e.g. std::less)
+ * @param arr Vector to be sorted
+ * @param comp Comparison function
+ */
 template <typename T, typename Compare>
-void merge_custom(std::vector<T>& arr, std::vector<T>& temp, int left, int mid, int right, Compare comp) {
-    int i = left, j = mid + 1, k = left;
+void merge_sort_custom(std::vector<T>& arr, Compare comp) {
+    merge_sort_custom(arr.begin(), arr.end(), comp);
+}
 
-    while (i <= mid && j <= right) {
-        if (comp(arr[i], arr[j])) {
-            temp[k++] = arr[i++];
+/**
+ * @brief Number of leading elements of base[0..len) that are <= key
+ *
+ * Exponential ("galloping") search followed by a binary search, so finding
+ * a position p costs O(log p) comparisons instead of O(log len).
+ */
+template <typename T, typename Compare>
+size_t gallop_upper(const T& key, const T* base, size_t len, Compare comp) {
+    size_t bound = 1;
+    while (bound < len && !comp(key, base[bound - 1])) {
+        bound *= 2;
+    }
+    size_t low = bound / 2;
+    size_t high = std::min(bound, len);
+    return low + (std::upper_bound(base + low, base + high, key, comp) - (base + low));
+}
+
+/**
+ * @brief Number of leading elements of base[0..len) that are < key
+ */
+template <typename T, typename Compare>
+size_t gallop_lower(const T& key, const T* base, size_t len, Compare comp) {
+    size_t bound = 1;
+    while (bound < len && comp(base[bound - 1], key)) {
+        bound *= 2;
+    }
+    size_t low = bound / 2;
+    size_t high = std::min(bound, len);
+    return low + (std::lower_bound(base + low, base + high, key, comp) - (base + low));
+}
+
+/**
+ * @brief Stable merge of src[left..mid) and src[mid..right) into dst, with galloping
+ *
+ * Starts as an ordinary one-at-a-time merge. Once one side wins
+ * min_gallop times in a row, switches to galloping: the length of that
+ * side's winning streak is found by exponential search and moved in one
+ * block. Galloping continues while it keeps paying off; min_gallop adapts
+ * (as in TimSort) so random data stays in the cheap one-at-a-time mode.
+ */
+template <typename T, typename Compare>
+void merge_galloping(T* src, T* dst, size_t left, size_t mid, size_t right, Compare comp, size_t& min_gallop) {
+    const size_t gallop_threshold = 7;
+    size_t i = left, j = mid, k = left;
+
+    while (i < mid && j < right) {
+        size_t left_wins = 0, right_wins = 0;
+
+        while (i < mid && j < right && left_wins < min_gallop && right_wins < min_gallop) {
+            if (comp(src[j], src[i])) {
+                dst[k++] = std::move(src[j++]);
+                right_wins++;
+                left_wins = 0;
+            } else {
+                dst[k++] = std::move(src[i++]);
+                left_wins++;
+                right_wins = 0;
+            }
+        }
+
+        while (i < mid && j < right) {
+            size_t from_left = gallop_upper(src[j], src + i, mid - i, comp);
+            std::move(src + i, src + i + from_left, dst + k);
+            i += from_left;
+            k += from_left;
+            if (i == mid) break;
+            dst[k++] = std::move(src[j++]);
+            if (j == right) break;
+
+            size_t from_right = gallop_lower(src[i], src + j, right - j, comp);
+            std::move(src + j, src + j + from_right, dst + k);
+            j += from_right;
+            k += from_right;
+            if (j == right) break;
+            dst[k++] = std::move(src[i++]);
+            if (i == mid) break;
+
+            if (from_left < gallop_threshold && from_right < gallop_threshold) {
+                min_gallop += 2;  // Galloping stopped paying off
+                break;
+            }
+            if (min_gallop > 1) min_gallop--;
+        }
+    }
+
+    std::move(src + i, src + mid, dst + k);
+    k += mid - i;
+    std::move(src + j, src + right, dst + k);
+}
+
+/**
+ * @brief Adaptive (natural) merge sort with a single scratch buffer
+ *
+ * 1. Scans the input for natural runs: maximal non-descending stretches,
+ *    or strictly descending ones, which are reversed in place (strictly,
+ *    so reversing never reorders equal elements).
+ * 2. Runs shorter than min_run are extended with binary insertion sort,
+ *    so random input starts from runs of min_run instead of single elements.
+ * 3. Adjacent runs are merged pairwise, level by level, with
+ *    merge_galloping. Each level reads from one array and writes to the
+ *    other (ping-pong), so nothing is copied back between levels and the
+ *    only allocations are the scratch buffer and the run boundaries, made
+ *    once per sort.
+ *
+ * Sorted or reverse-sorted input is a single run and finishes after n - 1
+ * comparisons; input made of a few sorted batches costs O(n log r) for
+ * r runs, and galloping makes merging runs that barely overlap close to
+ * linear.
+ *
+ * Time Complexity: O(n) best case, O(n log n) worst case
+ * Space Complexity: O(n) - one scratch buffer
+ * Stable: Yes (with a strict comparator such as std::less)
+ *
+ * @param arr Vector to be sorted
+ * @param comp Comparison function (strict weak ordering)
+ */
+template <typename T, typename Compare = std::less<T>>
+void merge_sort_adaptive(std::vector<T>& arr, Compare comp = Compare()) {
+    const size_t min_run = 32;
+    size_t n = arr.size();
+    if (n <= 1) return;
+
+    // Phase 1: natural runs, extended to min_run
+    std::vector<size_t> bounds;  // Run i is [bounds[i], bounds[i + 1])
+    bounds.reserve(n / min_run + 2);
+    bounds.push_back(0);
+
+    size_t start = 0;
+    while (start < n) {
+        size_t end = start + 1;
+        if (end < n) {
+            if (comp(arr[end], arr[start])) {
+                while (end < n && comp(arr[end], arr[end - 1])) end++;
+                std::reverse(arr.begin() + start, arr.begin() + end);
+            } else {
+                while (end < n && !comp(arr[end], arr[end - 1])) end++;
+            }
+        }
+
+        size_t forced_end = std::min(n, start + min_run);
+        for (; end < forced_end; ++end) {
+            auto pos = std::upper_bound(arr.begin() + start, arr.begin() + end, arr[end], comp);
+            T value = std::move(arr[end]);
+            std::move_backward(pos, arr.begin() + end, arr.begin() + end + 1);
+            *pos = std::move(value);
+        }
+
+        bounds.push_back(end);
+        start = end;
+    }
+
+    if (bounds.size() == 2) return;  // Already a single run
+
+    // Phase 2: ping-pong merging of adjacent runs
+    std::vector<T> buffer(n);
+    T* src = arr.data();
+    T* dst = buffer.data();
+    size_t min_gallop = 7;
+
+    while (bounds.size() > 2) {
+        size_t runs = bounds.size() - 1;
+        size_t merged = 0;
+
+        for (size_t r = 0; r + 1 < runs; r += 2) {
+            merge_galloping(src, dst, bounds[r], bounds[r + 1], bounds[r + 2], comp, min_gallop);
+            bounds[merged++] = bounds[r];
+        }
+        if (runs % 2 == 1) {
+            std::move(src + bounds[runs - 1], src + n, dst + bounds[runs - 1]);
+            bounds[merged++] = bounds[runs - 1];
+        }
+        bounds[merged++] = n;
+        bounds.resize(merged);
+
+        std::swap(src, dst);
+    }
+
+    if (src != arr.data()) {
+        std::move(src, src + n, arr.data());
+    }
+}
+
+/**
+ * @brief Bottom-up merge sort with sorting-network leaves (int32_t / float)
+ *
+ * Blocks of 64 elements are sorted with sorting_network_sort, then merged
+ * pairwise with merge_sorted_blocks between arr and one buffer, as in
+ * merge_sort_adaptive. On AVX2/AVX-512 both the leaves and the merges run
+ * 8 or 16 lanes at a time. Without SIMD the leaves fall back to std::sort,
+ * which beats the scalar network at this size.
+ *
+ * Not stable, which makes no difference for plain numbers.
+ *
+ * @param arr Vector to be sorted
+ */
+template <typename T>
+void merge_sort_hybrid(std::vector<T>& arr) {
+    const size_t n = arr.size();
+    const size_t leaf = sorting_network_max_size;
+    const bool vectorized = active_simd_level() != SimdLevel::Scalar;
+
+    for (size_t begin = 0; begin < n; begin += leaf) {
+        size_t end = std::min(begin + leaf, n);
+        if (vectorized) {
+            sorting_network_sort(arr.data() + begin, end - begin);
         } else {
-            temp[k++] = arr[j++];
+            std::sort(arr.begin() + begin, arr.begin() + end);
         }
     }
+    if (n <= leaf) return;
 
-    while (i <= mid) temp[k++] = arr[i++];
-    while (j <= right) temp[k++] = arr[j++];
+    std::vector<T> buffer(n);
+    T* src = arr.data();
+    T* dst = buffer.data();
 
-    for (i = left; i <= right; ++i) {
-        arr[i] = temp[i];
+    for (size_t width = leaf; width < n; width *= 2) {
+        for (size_t left = 0; left < n; left += 2 * width) {
+            size_t mid = std::min(left + width, n);
+            size_t right = std::min(left + 2 * width, n);
+            merge_sorted_blocks(src + left, mid - left, src + mid, right - mid, dst + left);
+        }
+        std::swap(src, dst);
+    }
+
+    if (src != arr.data()) {
+        std::copy(src, src + n, arr.data());
     }
 }
 
+long long merge_and_count(std::vector<int>& arr, int left, int mid, int right);
+
 /**
  * @brief Count inversions using merge sort
  * An inversion is a pair (i, j) such that i < j and arr[i] > arr[j]
@@ -291,7 +609,9 @@ long long merge_and_count(std::vector<int>& arr, int left, int mid, int right) {
 
 /**
  * @brief External Merge Sort for large files
- * Demonstrates the concept of sorting data that doesn't fit in memory
+ * Demonstrates the concept of sorting data that doesn't fit in memory.
+ * Everything stays in RAM here; external_merge_sort below is the
+ * disk-backed version.
  * @param data Large dataset to be sorted
  * @param memory_limit Maximum size of data that can fit in memory
  */
@@ -350,15 +670,894 @@ void external_merge_sort_simulation(std::vector<int>& data, size_t memory_limit)
 }
 
 /**
- * @brief Parallel Merge Sort (conceptual implementation)
- * Demonstrates how merge sort can be parallelized
+ * @brief Fork-join thread pool with work stealing
+ *
+ * Every worker owns a deque of tasks. A worker pushes the tasks it spawns
+ * onto the back of its own deque and pops from the back (LIFO, so it keeps
+ * working on the data it just touched), while idle workers steal from the
+ * front of other deques (FIFO, so they take the oldest and therefore
+ * largest pieces of a divide-and-conquer computation).
+ *
+ * wait() does not block: the waiting thread keeps running queued tasks
+ * until its group is done, so nested fork-join never deadlocks and a pool
+ * of P threads keeps all P busy. Threads outside the pool (e.g. the caller
+ * of parallel_merge_sort) act as worker 0, which has no thread of its own.
+ */
+class ForkJoinPool {
+public:
+    /**
+     * @brief Set of spawned tasks that can be waited on together
+     */
+    class TaskGroup {
+    private:
+        friend class ForkJoinPool;
+        std::atomic<size_t> pending{0};
+        std::exception_ptr error;
+        std::mutex error_mutex;
+    };
+
+private:
+    struct Worker {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;  // Index 0 is shared by external threads
+    std::vector<std::thread> threads;
+    std::atomic<size_t> queued{0};                  // Tasks sitting in any deque
+    std::atomic<bool> stopping{false};
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+
+    static inline thread_local ForkJoinPool* current_pool = nullptr;
+    static inline thread_local size_t current_index = 0;
+
+    size_t worker_index() const {
+        return current_pool == this ? current_index : 0;
+    }
+
+    bool pop_local(size_t index, std::function<void()>& task) {
+        Worker& worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty()) {
+            return false;
+        }
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, std::function<void()>& task) {
+        for (size_t offset = 1; offset < workers.size(); ++offset) {
+            Worker& victim = *workers[(thief + offset) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Run one queued task, own deque first, then stolen
+     * @return false if every deque was empty
+     */
+    bool run_one(size_t index) {
+        std::function<void()> task;
+        if (!pop_local(index, task) && !steal(index, task)) {
+            return false;
+        }
+        queued.fetch_sub(1, std::memory_order_relaxed);
+        task();
+        return true;
+    }
+
+    void worker_loop(size_t index) {
+        current_pool = this;
+        current_index = index;
+
+        while (!stopping.load(std::memory_order_acquire)) {
+            if (run_one(index)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            wake.wait(lock, [this] {
+                return stopping.load(std::memory_order_acquire) ||
+                       queued.load(std::memory_order_acquire) > 0;
+            });
+        }
+    }
+
+public:
+    /**
+     * @brief Create a pool in which num_threads threads (including the caller) run tasks
+     */
+    explicit ForkJoinPool(size_t num_threads = std::thread::hardware_concurrency()) {
+        num_threads = std::max<size_t>(1, num_threads);
+        for (size_t i = 0; i < num_threads; ++i) {
+            workers.push_back(std::make_unique<Worker>());
+        }
+        for (size_t i = 1; i < num_threads; ++i) {
+            threads.emplace_back(&ForkJoinPool::worker_loop, this, i);
+        }
+    }
+
+    ~ForkJoinPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping.store(true, std::memory_order_release);
+        }
+        wake.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    ForkJoinPool(const ForkJoinPool&) = delete;
+    ForkJoinPool& operator=(const ForkJoinPool&) = delete;
+
+    size_t thread_count() const { return workers.size(); }
+
+    /**
+     * @brief Queue a task as part of group; exceptions are rethrown by wait()
+     */
+    template <typename Task>
+    void spawn(TaskGroup& group, Task&& task) {
+        group.pending.fetch_add(1, std::memory_order_relaxed);
+
+        std::function<void()> wrapped = [&group, task = std::forward<Task>(task)]() mutable {
+            try {
+                task();
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(group.error_mutex);
+                if (!group.error) {
+                    group.error = std::current_exception();
+                }
+            }
+            group.pending.fetch_sub(1, std::memory_order_release);
+        };
+
+        Worker& worker = *workers[worker_index()];
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.tasks.push_back(std::move(wrapped));
+        }
+        queued.fetch_add(1, std::memory_order_release);
+
+        { std::lock_guard<std::mutex> lock(sleep_mutex); }
+        wake.notify_one();
+    }
+
+    /**
+     * @brief Run queued tasks until every task of group has finished
+     */
+    void wait(TaskGroup& group) {
+        size_t index = worker_index();
+        while (group.pending.load(std::memory_order_acquire) != 0) {
+            if (!run_one(index)) {
+                std::this_thread::yield();
+            }
+        }
+
+        if (group.error) {
+            std::exception_ptr error = group.error;
+            group.error = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+/**
+ * @brief Co-rank: how many of the first k merged outputs come from a
+ *
+ * Finds i such that merging a[0..i) with b[0..k-i) yields exactly the first
+ * k elements of the stable merge of a and b (ties go to a), by binary
+ * search over i. Splitting the output at evenly spaced k lets independent
+ * threads each merge one slice.
+ */
+template <typename T, typename Compare>
+size_t merge_co_rank(size_t k, const T* a, size_t na, const T* b, size_t nb, Compare comp) {
+    size_t low = k > nb ? k - nb : 0;
+    size_t high = std::min(k, na);
+
+    while (low < high) {
+        size_t i = low + (high - low) / 2;
+        size_t j = k - i;
+        // a[i] <= b[j-1]: a[i] must precede b[j-1], so take more of a
+        if (j > 0 && !comp(b[j - 1], a[i])) {
+            low = i + 1;
+        } else {
+            high = i;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Stable serial merge of a[0..na) and b[0..nb) into out, moving elements
+ */
+template <typename T, typename Compare>
+void merge_move(T* a, size_t na, T* b, size_t nb, T* out, Compare comp) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        if (!comp(b[j], a[i])) {
+            *out++ = std::move(a[i++]);
+        } else {
+            *out++ = std::move(b[j++]);
+        }
+    }
+    while (i < na) *out++ = std::move(a[i++]);
+    while (j < nb) *out++ = std::move(b[j++]);
+}
+
+/**
+ * @brief State shared by the tasks of one parallel_merge_sort call
+ */
+template <typename T, typename Compare>
+struct ParallelMergeSortContext {
+    ForkJoinPool& pool;
+    std::vector<T>& arr;
+    std::vector<T>& buffer;
+    Compare comp;
+    size_t grain;  // Ranges at most this long are sorted serially
+};
+
+/**
+ * @brief Merge src[left..mid) and src[mid..right) into dst[left..right)
+ *
+ * Large merges are cut into slices of about ctx.grain outputs; the split
+ * points come from merge_co_rank, so slices are independent and are
+ * merged as parallel tasks.
+ */
+template <typename T, typename Compare>
+void parallel_merge(ParallelMergeSortContext<T, Compare>& ctx, T* src, T* dst,
+                    size_t left, size_t mid, size_t right) {
+    T* a = src + left;
+    T* b = src + mid;
+    size_t na = mid - left;
+    size_t nb = right - mid;
+    size_t total = na + nb;
+
+    size_t slices = std::min(total / ctx.grain, ctx.pool.thread_count() * 4);
+    if (slices <= 1) {
+        merge_move(a, na, b, nb, dst + left, ctx.comp);
+        return;
+    }
+
+    ForkJoinPool::TaskGroup group;
+    for (size_t s = 0; s < slices; ++s) {
+        size_t k_begin = total * s / slices;
+        size_t k_end = total * (s + 1) / slices;
+        ctx.pool.spawn(group, [&ctx, a, b, na, nb, dst, left, k_begin, k_end] {
+            size_t i_begin = merge_co_rank(k_begin, a, na, b, nb, ctx.comp);
+            size_t i_end = merge_co_rank(k_end, a, na, b, nb, ctx.comp);
+            size_t j_begin = k_begin - i_begin;
+            size_t j_end = k_end - i_end;
+            merge_move(a + i_begin, i_end - i_begin, b + j_begin, j_end - j_begin,
+                       dst + left + k_begin, ctx.comp);
+        });
+    }
+    ctx.pool.wait(group);
+}
+
+/**
+ * @brief Sort [left, right), leaving the result in arr or, if to_buffer, in buffer
+ *
+ * The two halves are sorted into the opposite array and then merged into
+ * the requested one, so each level moves every element exactly once and
+ * no copy-back pass is needed.
+ */
+template <typename T, typename Compare>
+void parallel_merge_sort_range(ParallelMergeSortContext<T, Compare>& ctx, size_t left, size_t right, bool to_buffer) {
+    if (right - left <= ctx.grain) {
+        merge_sort_helper(ctx.arr, ctx.buffer, static_cast<int>(left), static_cast<int>(right) - 1, ctx.comp);
+        if (to_buffer) {
+            std::move(ctx.arr.begin() + left, ctx.arr.begin() + right, ctx.buffer.begin() + left);
+        }
+        return;
+    }
+
+    size_t mid = left + (right - left) / 2;
+
+    ForkJoinPool::TaskGroup group;
+    ctx.pool.spawn(group, [&ctx, left, mid, to_buffer] {
+        parallel_merge_sort_range(ctx, left, mid, !to_buffer);
+    });
+    parallel_merge_sort_range(ctx, mid, right, !to_buffer);
+    ctx.pool.wait(group);
+
+    T* src = to_buffer ? ctx.arr.data() : ctx.buffer.data();
+    T* dst = to_buffer ? ctx.buffer.data() : ctx.arr.data();
+    parallel_merge(ctx, src, dst, left, mid, right);
+}
+
+/**
+ * @brief Parallel stable merge sort on a work-stealing fork-join pool
+ *
+ * Recursively halves the array, sorting one half in a spawned task and
+ * the other on the current thread. Ranges of at most grain elements are
+ * sorted with the serial merge_sort_helper (the kernel of
+ * merge_sort_custom). Merges are themselves parallel: the output is split
+ * into slices whose input boundaries are found by co-ranking.
+ *
+ * Time Complexity: O(n log n) work, O(log^2 n) span
+ * Space Complexity: O(n) - one buffer the size of the input
+ * Stable: Yes (with a strict comparator such as std::less)
+ *
+ * @param arr Vector to be sorted
+ * @param comp Comparison function (strict weak ordering)
+ * @param threads Number of threads to use, including the caller
+ * @param grain Subranges of at most this many elements are sorted serially
  */
-void parallel_merge_sort_concept(std::vector<int>& arr) {
-    std::cout << "Parallel Merge Sort Concept:" << std::endl;
-    std::cout << "1. Divide array into chunks" << std::endl;
-    std::cout << "2. Sort each chunk on separate thread" << std::endl;
-    std::cout << "3. Merge sorted chunks using parallel merge" << std::endl;
-    std::cout << "4. This can significantly speed up sorting on multi-core systems" << std::endl;
+template <typename T, typename Compare = std::less<T>>
+void parallel_merge_sort(std::vector<T>& arr, Compare comp = Compare(),
+                         size_t threads = std::thread::hardware_concurrency(),
+                         size_t grain = 16384) {
+    grain = std::max<size_t>(grain, 2);
+    if (arr.size() <= grain || threads <= 1) {
+        merge_sort_custom(arr, comp);
+        return;
+    }
+
+    ForkJoinPool pool(threads);
+    std::vector<T> buffer(arr.size());
+    ParallelMergeSortContext<T, Compare> ctx{pool, arr, buffer, comp, grain};
+    parallel_merge_sort_range(ctx, 0, arr.size(), false);
+}
+
+/**
+ * @brief Tournament tree of losers for k-way merging
+ *
+ * Each internal node stores the loser of the match played there and
+ * tree[0] holds the overall winner. Replacing the winner's key replays
+ * only the path from its leaf to the root: exactly ceil(log2 k)
+ * comparisons, against roughly 2 log2 k for a binary-heap pop + push,
+ * and no element moves at all.
+ *
+ * Ties are won by the lower leaf index, so merging runs that are in
+ * input order keeps the merge stable.
+ */
+template <typename T, typename Compare = std::less<T>>
+class LoserTree {
+private:
+    size_t k;
+    std::vector<size_t> tree;     // tree[0] = winner, tree[1..k-1] = losers
+    std::vector<T> keys;          // Current head of every leaf
+    std::vector<char> exhausted;  // Leaf has no more elements
+    Compare comp;
+
+    /**
+     * @brief Does leaf a win against leaf b?
+     */
+    bool beats(size_t a, size_t b) const {
+        if (exhausted[a]) return false;
+        if (exhausted[b]) return true;
+        if (comp(keys[a], keys[b])) return true;
+        if (comp(keys[b], keys[a])) return false;
+        return a < b;
+    }
+
+    void replay(size_t leaf) {
+        size_t winner = leaf;
+        for (size_t node = (k + leaf) / 2; node > 0; node /= 2) {
+            if (beats(tree[node], winner)) {
+                std::swap(tree[node], winner);
+            }
+        }
+        tree[0] = winner;
+    }
+
+public:
+    explicit LoserTree(size_t num_leaves, Compare comp = Compare())
+        : k(std::max<size_t>(1, num_leaves)), tree(k, 0), keys(k), exhausted(k, 1), comp(comp) {}
+
+    /**
+     * @brief Set the first key of a leaf (before build())
+     */
+    void set(size_t leaf, const T& key) {
+        keys[leaf] = key;
+        exhausted[leaf] = 0;
+    }
+
+    /**
+     * @brief Play the initial tournament; leaves never set() count as exhausted
+     */
+    void build() {
+        // winners[n] is the winner of the subtree at node n; leaves sit at k..2k-1
+        std::vector<size_t> winners(2 * k);
+        for (size_t leaf = 0; leaf < k; ++leaf) {
+            winners[k + leaf] = leaf;
+        }
+        for (size_t node = k - 1; node > 0; --node) {
+            size_t a = winners[2 * node];
+            size_t b = winners[2 * node + 1];
+            bool a_wins = beats(a, b);
+            winners[node] = a_wins ? a : b;
+            tree[node] = a_wins ? b : a;
+        }
+        tree[0] = (k == 1) ? 0 : winners[1];
+    }
+
+    bool empty() const { return exhausted[tree[0]] != 0; }
+    size_t winner() const { return tree[0]; }
+    const T& top() const { return keys[tree[0]]; }
+
+    /**
+     * @brief Replace the winning key with the next key from the same leaf
+     */
+    void replace_top(const T& key) {
+        keys[tree[0]] = key;
+        replay(tree[0]);
+    }
+
+    /**
+     * @brief Mark the winning leaf as exhausted
+     */
+    void pop_leaf() {
+        exhausted[tree[0]] = 1;
+        replay(tree[0]);
+    }
+};
+
+/**
+ * @brief Double-buffered sequential reader of a binary run file
+ *
+ * While the caller consumes one buffer, the next one is filled by an
+ * asynchronous fread, so disk reads overlap with merging. Read errors and
+ * files that end mid-element throw std::runtime_error from read(), so a
+ * failing disk can never silently shorten a run.
+ */
+template <typename T>
+class ExternalRunReader {
+private:
+    std::FILE* file;
+    std::filesystem::path path;
+    std::vector<T> current;
+    std::vector<T> next;
+    size_t position = 0;
+    size_t count = 0;
+    uintmax_t bytes_read = 0;  // Only touched by the prefetch task
+    std::future<size_t> pending;
+
+    void prefetch() {
+        pending = std::async(std::launch::async, [this] {
+            size_t got = std::fread(next.data(), sizeof(T), next.size(), file);
+            bytes_read += got * sizeof(T);
+            if (got < next.size()) {
+                if (std::ferror(file) || !std::feof(file)) {
+                    throw std::runtime_error("Read failed on " + path.string());
+                }
+                // At EOF the position is the file size; extra bytes are a partial element
+                long end = std::ftell(file);
+                if (end < 0 || static_cast<uintmax_t>(end) != bytes_read) {
+                    throw std::runtime_error("Truncated element at end of " + path.string());
+                }
+            }
+            return got;
+        });
+    }
+
+public:
+    ExternalRunReader(const std::filesystem::path& path, size_t buffer_elements)
+        : file(std::fopen(path.string().c_str(), "rb")), path(path),
+          current(std::max<size_t>(1, buffer_elements)),
+          next(std::max<size_t>(1, buffer_elements)) {
+        if (!file) {
+            throw std::runtime_error("Cannot open run file " + path.string());
+        }
+        prefetch();
+    }
+
+    ~ExternalRunReader() {
+        if (pending.valid()) pending.wait();
+        std::fclose(file);
+    }
+
+    ExternalRunReader(const ExternalRunReader&) = delete;
+    ExternalRunReader& operator=(const ExternalRunReader&) = delete;
+
+    /**
+     * @brief Read the next element
+     * @return false at end of file
+     * @throws std::runtime_error on a read error or a partial trailing element
+     */
+    bool read(T& value) {
+        if (position == count) {
+            if (!pending.valid()) {
+                return false;
+            }
+            count = pending.get();  // Rethrows errors from the prefetch task
+            if (count == 0) {
+                return false;  // The task only returns 0 at a clean EOF
+            }
+            std::swap(current, next);
+            position = 0;
+            if (count == current.size()) {
+                prefetch();  // A short read means end of file
+            }
+        }
+        value = current[position++];
+        return true;
+    }
+};
+
+/**
+ * @brief Double-buffered sequential writer of a binary file
+ *
+ * Full buffers are handed to an asynchronous fwrite while the caller keeps
+ * filling the other one.
+ */
+template <typename T>
+class ExternalRunWriter {
+private:
+    std::FILE* file;
+    std::filesystem::path path;
+    std::vector<T> current;
+    std::vector<T> flushing;
+    size_t count = 0;           // Elements buffered in current
+    size_t flushing_count = 0;  // Elements being written from flushing
+    std::future<size_t> pending;
+
+    void wait_pending() {
+        if (pending.valid()) {
+            if (pending.get() != flushing_count) {
+                throw std::runtime_error("Write failed on " + path.string());
+            }
+        }
+    }
+
+public:
+    ExternalRunWriter(const std::filesystem::path& path, size_t buffer_elements)
+        : file(std::fopen(path.string().c_str(), "wb")), path(path) {
+        if (!file) {
+            throw std::runtime_error("Cannot create " + path.string());
+        }
+        current.resize(std::max<size_t>(1, buffer_elements));
+        flushing.resize(current.size());
+    }
+
+    ~ExternalRunWriter() {
+        if (pending.valid()) pending.wait();
+        if (file) std::fclose(file);
+    }
+
+    ExternalRunWriter(const ExternalRunWriter&) = delete;
+    ExternalRunWriter& operator=(const ExternalRunWriter&) = delete;
+
+    void write(const T& value) {
+        current[count++] = value;
+        if (count == current.size()) {
+            flush_buffer();
+        }
+    }
+
+    /**
+     * @brief Write a block directly, after everything buffered so far
+     */
+    void write_block(const T* data, size_t n) {
+        flush_buffer();
+        wait_pending();
+        if (std::fwrite(data, sizeof(T), n, file) != n) {
+            throw std::runtime_error("Write failed on " + path.string());
+        }
+    }
+
+    void flush_buffer() {
+        if (count == 0) return;
+        wait_pending();
+        std::swap(current, flushing);
+        flushing_count = count;
+        count = 0;
+        pending = std::async(std::launch::async, [this] {
+            return std::fwrite(flushing.data(), sizeof(T), flushing_count, file);
+        });
+    }
+
+    /**
+     * @brief Flush everything and close the file
+     */
+    void close() {
+        flush_buffer();
+        wait_pending();
+        if (std::fclose(file) != 0) {
+            file = nullptr;
+            throw std::runtime_error("Cannot close " + path.string());
+        }
+        file = nullptr;
+    }
+};
+
+/**
+ * @brief Tuning knobs for external_merge_sort
+ */
+struct ExternalSortOptions {
+    size_t memory_limit = 256 * 1024 * 1024;  // Bytes of RAM the sort may use
+    size_t max_open_files = 64;               // Maximum runs merged in one pass
+    size_t min_buffer_bytes = 64 * 1024;      // Smallest per-run read buffer
+    size_t threads = std::thread::hardware_concurrency();
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+};
+
+/**
+ * @brief What external_merge_sort did
+ */
+struct ExternalSortStats {
+    size_t elements = 0;
+    size_t initial_runs = 0;
+    size_t merge_passes = 0;  // Passes over the data after run formation
+};
+
+/**
+ * @brief Temporary run files, deleted when the set goes out of scope
+ */
+class ExternalRunFiles {
+private:
+    std::filesystem::path dir;
+    std::string prefix;
+    size_t counter = 0;
+
+public:
+    std::vector<std::filesystem::path> created;
+
+    explicit ExternalRunFiles(const std::filesystem::path& temp_dir) : dir(temp_dir) {
+        prefix = "external_sort_" + std::to_string(std::random_device{}()) + "_";
+    }
+
+    ~ExternalRunFiles() {
+        std::error_code ignored;
+        for (const auto& path : created) {
+            std::filesystem::remove(path, ignored);
+        }
+    }
+
+    std::filesystem::path make() {
+        created.push_back(dir / (prefix + std::to_string(counter++) + ".run"));
+        return created.back();
+    }
+
+    void remove(const std::filesystem::path& path) {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+};
+
+/**
+ * @brief K-way merge of sorted run files into output through a loser tree
+ */
+template <typename T, typename Compare>
+void merge_run_files(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output,
+                     size_t buffer_elements, Compare comp) {
+    std::vector<std::unique_ptr<ExternalRunReader<T>>> readers;
+    LoserTree<T, Compare> tree(runs.size(), comp);
+
+    for (size_t i = 0; i < runs.size(); ++i) {
+        readers.push_back(std::make_unique<ExternalRunReader<T>>(runs[i], buffer_elements));
+        T first;
+        if (readers[i]->read(first)) {
+            tree.set(i, first);
+        }
+    }
+    tree.build();
+
+    ExternalRunWriter<T> writer(output, buffer_elements);
+    T value;
+    while (!tree.empty()) {
+        writer.write(tree.top());
+        if (readers[tree.winner()]->read(value)) {
+            tree.replace_top(value);
+        } else {
+            tree.pop_leaf();
+        }
+    }
+    writer.close();
+}
+
+/**
+ * @brief Disk-backed external merge sort of a binary file of T
+ *
+ * Phase 1 (run formation): reads the input in runs of memory_limit / 2
+ * bytes (parallel_merge_sort needs an equal-sized buffer), sorts each run
+ * with parallel_merge_sort and spills it to a temporary file. Input that
+ * fits in a single run is written straight to output.
+ *
+ * Phase 2 (merging): merges up to fan-in runs at a time with a LoserTree,
+ * reading every run and writing the output through double buffers whose
+ * I/O runs asynchronously. The fan-in is limited by max_open_files and by
+ * how many min_buffer_bytes double buffers fit in memory_limit; when there
+ * are more runs than that, intermediate passes merge groups of runs into
+ * longer runs until one final pass writes output.
+ *
+ * Time Complexity: O(n log n) comparisons, O(n * passes) I/O
+ * Space Complexity: memory_limit bytes of RAM, about 2x the input on disk
+ * Stable: Yes
+ *
+ * @tparam T Trivially copyable element type stored raw in the files
+ * @param input_path Binary file containing the elements to sort
+ * @param output_path File that receives the sorted elements
+ * @param options Memory/file budgets, thread count and temp directory
+ * @param comp Comparison function (strict weak ordering)
+ * @return Statistics about the runs and passes
+ */
+template <typename T, typename Compare = std::less<T>>
+ExternalSortStats external_merge_sort(const std::filesystem::path& input_path,
+                                      const std::filesystem::path& output_path,
+                                      const ExternalSortOptions& options = ExternalSortOptions(),
+                                      Compare comp = Compare()) {
+    static_assert(std::is_trivially_copyable<T>::value, "external_merge_sort stores raw bytes");
+
+    ExternalSortStats stats;
+    uintmax_t file_bytes = std::filesystem::file_size(input_path);
+    if (file_bytes % sizeof(T) != 0) {
+        throw std::runtime_error("Input size is not a multiple of the element size");
+    }
+    stats.elements = static_cast<size_t>(file_bytes / sizeof(T));
+
+    size_t run_elements = std::max<size_t>(1, options.memory_limit / (2 * sizeof(T)));
+    ExternalRunFiles temp_files(options.temp_dir);
+    std::vector<std::filesystem::path> runs;
+
+    // Phase 1: sorted runs
+    {
+        std::FILE* input = std::fopen(input_path.string().c_str(), "rb");
+        if (!input) {
+            throw std::runtime_error("Cannot open " + input_path.string());
+        }
+        std::unique_ptr<std::FILE, int (*)(std::FILE*)> input_guard(input, &std::fclose);
+
+        std::vector<T> run;
+        size_t remaining = stats.elements;
+        while (remaining > 0) {
+            run.resize(std::min(run_elements, remaining));
+            if (std::fread(run.data(), sizeof(T), run.size(), input) != run.size()) {
+                throw std::runtime_error("Read failed on " + input_path.string());
+            }
+            remaining -= run.size();
+            parallel_merge_sort(run, comp, options.threads);
+
+            bool only_run = runs.empty() && remaining == 0;
+            std::filesystem::path target = only_run ? output_path : temp_files.make();
+            ExternalRunWriter<T> writer(target, 1);
+            writer.write_block(run.data(), run.size());
+            writer.close();
+            if (!only_run) {
+                runs.push_back(target);
+            }
+        }
+        stats.initial_runs = std::max<size_t>(runs.size(), stats.elements > 0 ? 1 : 0);
+    }
+
+    if (stats.elements == 0) {
+        ExternalRunWriter<T>(output_path, 1).close();
+        return stats;
+    }
+    if (runs.empty()) {
+        return stats;  // Single run already written to output
+    }
+
+    // Phase 2: merge passes. Every run and the output get two buffers.
+    size_t min_buffer_elements = std::max<size_t>(1, options.min_buffer_bytes / sizeof(T));
+    size_t memory_fan_in = options.memory_limit / sizeof(T) / (2 * min_buffer_elements);
+    size_t fan_in = std::max<size_t>(2, std::min(options.max_open_files, memory_fan_in > 1 ? memory_fan_in - 1 : 1));
+
+    while (runs.size() > 1) {
+        bool final_pass = runs.size() <= fan_in;
+        std::vector<std::filesystem::path> next_runs;
+
+        for (size_t begin = 0; begin < runs.size(); begin += fan_in) {
+            size_t end = std::min(begin + fan_in, runs.size());
+            std::vector<std::filesystem::path> group(runs.begin() + begin, runs.begin() + end);
+            size_t buffer_elements = std::max<size_t>(1, options.memory_limit / sizeof(T) / (2 * (group.size() + 1)));
+
+            std::filesystem::path target = final_pass ? output_path : temp_files.make();
+            merge_run_files<T>(group, target, buffer_elements, comp);
+            for (const auto& run : group) {
+                temp_files.remove(run);
+            }
+            next_runs.push_back(target);
+        }
+
+        runs = std::move(next_runs);
+        stats.merge_passes++;
+    }
+
+    return stats;
+}
+
+/**
+ * @brief Sort a random file with a small memory budget and verify the result
+ */
+void test_external_merge_sort_file(size_t n = 1000000) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    std::filesystem::path input = dir / "external_sort_demo_input.bin";
+    std::filesystem::path output = dir / "external_sort_demo_output.bin";
+
+    std::vector<int> data(n);
+    for (size_t i = 0; i < n; ++i) {
+        data[i] = rand();
+    }
+    {
+        ExternalRunWriter<int> writer(input, 1);
+        writer.write_block(data.data(), data.size());
+        writer.close();
+    }
+
+    ExternalSortOptions options;
+    options.memory_limit = 1024 * 1024;   // 1 MB: 128K-element runs
+    options.max_open_files = 4;           // Force multi-pass merging
+    options.min_buffer_bytes = 4 * 1024;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ExternalSortStats stats = external_merge_sort<int>(input, output, options);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::vector<int> sorted(n);
+    {
+        ExternalRunReader<int> reader(output, 4096);
+        for (size_t i = 0; i < n; ++i) {
+            reader.read(sorted[i]);
+        }
+    }
+    std::sort(data.begin(), data.end());
+
+    std::cout << "\n=== External Merge Sort (" << n << " ints, 1 MB memory) ===" << std::endl;
+    std::cout << "Initial runs: " << stats.initial_runs << ", merge passes: " << stats.merge_passes << std::endl;
+    std::cout << "Time: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms" << std::endl;
+    std::cout << "Correct: " << (sorted == data ? "yes" : "NO") << std::endl;
+
+    std::error_code ignored;
+    std::filesystem::remove(input, ignored);
+    std::filesystem::remove(output, ignored);
+}
+
+/**
+ * @brief Check that run read errors surface instead of truncating the output
+ */
+void test_external_merge_sort_errors() {
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    std::filesystem::path truncated = dir / "external_sort_truncated_run.bin";
+
+    // Three whole ints followed by two stray bytes
+    {
+        std::vector<int> data = {3, 1, 2};
+        ExternalRunWriter<int> writer(truncated, 1);
+        writer.write_block(data.data(), data.size());
+        writer.close();
+        std::FILE* file = std::fopen(truncated.string().c_str(), "ab");
+        std::fputc(0, file);
+        std::fputc(0, file);
+        std::fclose(file);
+    }
+
+    auto drain = [](const std::filesystem::path& path) {
+        ExternalRunReader<int> reader(path, 2);
+        int value;
+        size_t n = 0;
+        while (reader.read(value)) {
+            ++n;
+        }
+        return n;
+    };
+
+    std::cout << "\n=== External Merge Sort Read Errors ===" << std::endl;
+    try {
+        drain(truncated);
+        std::cout << "Truncated run: NOT detected" << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cout << "Truncated run: " << e.what() << std::endl;
+    }
+
+    // fopen succeeds on a directory but every fread fails and sets ferror
+    try {
+        drain(dir);
+        std::cout << "Unreadable run: NOT detected" << std::endl;
+    } catch (const std::runtime_error& e) {
+        std::cout << "Unreadable run: " << e.what() << std::endl;
+    }
+
+    std::error_code ignored;
+    std::filesystem::remove(truncated, ignored);
 }
 
 /**
@@ -417,7 +1616,7 @@ void test_merge_sort() {
 /**
  * @brief Performance comparison with other sorting algorithms
  */
-void compare_sorting_performance() {
+void compare_merge_sort_performance() {
     // Generate test data
     std::vector<int> test_data(10000);
     for (int i = 0; i < 10000; ++i) {
@@ -444,6 +1643,90 @@ void compare_sorting_performance() {
     std::cout << "std::sort (QuickSort): " << time2.count() << " μs" << std::endl;
 }
 
+/**
+ * @brief Compare parallel_merge_sort against the serial merge sorts
+ *
+ * Also checks stability by sorting (key, original index) pairs on the key
+ * only and verifying that equal keys keep their original order.
+ */
+void compare_parallel_merge_sort(size_t n = 10000000) {
+    std::vector<int> test_data(n);
+    for (size_t i = 0; i < n; ++i) {
+        test_data[i] = rand();
+    }
+    size_t threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+
+    std::cout << "\n=== Parallel Merge Sort (" << n << " elements, " << threads << " threads) ===" << std::endl;
+
+    auto time_sort = [](auto&& sort) {
+        auto start = std::chrono::high_resolution_clock::now();
+        sort();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    };
+
+    auto arr1 = test_data;
+    long long t1 = time_sort([&] { merge_sort(arr1); });
+    auto arr2 = test_data;
+    long long t2 = time_sort([&] { merge_sort_custom(arr2, std::less<int>()); });
+    auto arr3 = test_data;
+    long long t3 = time_sort([&] { parallel_merge_sort(arr3, std::less<int>(), threads); });
+
+    std::cout << "merge_sort:          " << t1 << " ms" << std::endl;
+    std::cout << "merge_sort_custom:   " << t2 << " ms" << std::endl;
+    std::cout << "parallel_merge_sort: " << t3 << " ms (speedup " << (t3 > 0 ? static_cast<double>(t1) / t3 : 0.0)
+              << "x over merge_sort)" << std::endl;
+    std::cout << "Results match: " << (arr1 == arr3 ? "yes" : "NO") << std::endl;
+
+    std::vector<std::pair<int, size_t>> pairs(n);
+    for (size_t i = 0; i < n; ++i) {
+        pairs[i] = {test_data[i] % 1000, i};
+    }
+    parallel_merge_sort(pairs, [](const auto& a, const auto& b) { return a.first < b.first; }, threads);
+    bool stable = std::is_sorted(pairs.begin(), pairs.end());
+    std::cout << "Stable: " << (stable ? "yes" : "NO") << std::endl;
+}
+
+/**
+ * @brief Compare merge_sort_adaptive with merge_sort_custom on presorted inputs
+ */
+void compare_adaptive_merge_sort(size_t n = 1000000) {
+    std::vector<int> random_data(n), sorted_data(n), nearly_sorted(n), batches(n);
+    for (size_t i = 0; i < n; ++i) {
+        random_data[i] = rand();
+        sorted_data[i] = static_cast<int>(i);
+        nearly_sorted[i] = static_cast<int>(i);
+        batches[i] = static_cast<int>((i % (n / 8)) * 8 + i / (n / 8));  // 8 interleaved sorted batches
+    }
+    for (size_t i = 0; i < n / 100; ++i) {
+        std::swap(nearly_sorted[rand() % n], nearly_sorted[rand() % n]);  // 1% of elements displaced
+    }
+
+    std::cout << "\n=== Adaptive Merge Sort (" << n << " elements) ===" << std::endl;
+
+    auto run = [](const std::string& name, const std::vector<int>& data) {
+        auto arr1 = data;
+        auto start = std::chrono::high_resolution_clock::now();
+        merge_sort_custom(arr1, std::less<int>());
+        auto end = std::chrono::high_resolution_clock::now();
+        auto time1 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        auto arr2 = data;
+        start = std::chrono::high_resolution_clock::now();
+        merge_sort_adaptive(arr2);
+        end = std::chrono::high_resolution_clock::now();
+        auto time2 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        std::cout << name << ": merge_sort_custom " << time1.count() << " μs, merge_sort_adaptive "
+                  << time2.count() << " μs" << (arr1 == arr2 ? "" : " (MISMATCH)") << std::endl;
+    };
+
+    run("Random          ", random_data);
+    run("Sorted          ", sorted_data);
+    run("Nearly sorted   ", nearly_sorted);
+    run("8 sorted batches", batches);
+}
+
 /**
  * @brief Demonstrate external merge sort
  */
@@ -1,7 +1,17 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
 #include <stack>
+#include <string>
+#include "00-Sort Utilities.cpp"  // identity_projection, make_projected_compare
+#include "06-Heap Sort.cpp"  // heap_sort_optimized
+#include "08-Selection.cpp"  // select_nth
+#include "10-Sorting Networks.cpp"  // sorting_network_sort
 
 /**
  * @brief Quick Sort Implementation
@@ -138,6 +148,10 @@ void quick_sort_median_of_three(std::vector<int>& arr, int low, int high) {
         if (arr[high] < arr[low]) std::swap(arr[low], arr[high]);
         if (arr[high] < arr[mid]) std::swap(arr[mid], arr[high]);
 
+        // Two or three elements are sorted by the step above, and the scan
+        // below needs arr[low] and arr[high] as sentinels around the pivot
+        if (high - low < 3) return;
+
         // Place median at high-1 position
         std::swap(arr[mid], arr[high - 1]);
 
@@ -221,19 +235,17 @@ void quick_sort_random_pivot(std::vector<int>& arr, int low, int high) {
 }
 
 /**
- * @brief Three-way Quick Sort (Dutch National Flag)
- * Efficient for arrays with many duplicate elements
- * @param arr Vector to be sorted
+ * @brief Three-way partition (Dutch National Flag) around pivot arr[low]
+ * @param arr Vector to be partitioned
  * @param low Starting index
  * @param high Ending index
+ * @param lt Output: first index of the elements equal to the pivot
+ * @param gt Output: last index of the elements equal to the pivot
  */
-void quick_sort_three_way(std::vector<int>& arr, int low, int high) {
-    if (low >= high) return;
-
-    // Three-way partition
+void partition_three_way(std::vector<int>& arr, int low, int high, int& lt, int& gt) {
     int pivot = arr[low];
-    int lt = low;      // arr[low..lt-1] < pivot
-    int gt = high;     // arr[gt+1..high] > pivot
+    lt = low;          // arr[low..lt-1] < pivot
+    gt = high;         // arr[gt+1..high] > pivot
     int i = low + 1;   // arr[lt..i-1] == pivot
 
     while (i <= gt) {
@@ -248,6 +260,20 @@ void quick_sort_three_way(std::vector<int>& arr, int low, int high) {
             i++;
         }
     }
+}
+
+/**
+ * @brief Three-way Quick Sort (Dutch National Flag)
+ * Efficient for arrays with many duplicate elements
+ * @param arr Vector to be sorted
+ * @param low Starting index
+ * @param high Ending index
+ */
+void quick_sort_three_way(std::vector<int>& arr, int low, int high) {
+    if (low >= high) return;
+
+    int lt, gt;
+    partition_three_way(arr, low, high, lt, gt);
 
     // Recursively sort less and greater partitions
     quick_sort_three_way(arr, low, lt - 1);
@@ -277,15 +303,24 @@ void quick_sort_tail_optimized(std::vector<int>& arr, int low, int high) {
 }
 
 /**
- * @brief Hybrid Quick Sort (switches to insertion sort for small subarrays)
- * Combines the benefits of both algorithms
+ * @brief Hybrid Quick Sort (switches to a small-array sort for small subarrays)
+ * Combines the benefits of both algorithms. Small subarrays go to a
+ * vectorized sorting network when the CPU has AVX2/AVX-512/NEON and
+ * they fit one (up to 64 elements), and to insertion sort otherwise.
  * @param arr Vector to be sorted
  * @param low Starting index
  * @param high Ending index
- * @param cutoff Size below which to use insertion sort
+ * @param cutoff Size at or below which the small-array sort takes over
  */
-void quick_sort_hybrid(std::vector<int>& arr, int low, int high, int cutoff = 10) {
-    if (high - low + 1 <= cutoff) {
+void quick_sort_hybrid(std::vector<int>& arr, int low, int high, int cutoff = 64) {
+    int size = high - low + 1;
+    if (size <= cutoff) {
+        if (size > 1 && size <= static_cast<int>(sorting_network_max_size) &&
+            active_simd_level() != SimdLevel::Scalar) {
+            sorting_network_sort(arr.data() + low, static_cast<size_t>(size));
+            return;
+        }
+
         // Use insertion sort for small subarrays
         for (int i = low + 1; i <= high; ++i) {
             int key = arr[i];
@@ -304,6 +339,76 @@ void quick_sort_hybrid(std::vector<int>& arr, int low, int high, int cutoff = 10
     quick_sort_hybrid(arr, pivot_idx + 1, high, cutoff);
 }
 
+namespace quick_detail {
+
+/**
+ * @brief Move-based insertion sort used to finish small partitions
+ */
+template <typename RandomIt, typename Less>
+void insertion_sort_range(RandomIt first, RandomIt last, Less& less) {
+    if (first == last) return;
+    for (RandomIt i = first + 1; i != last; ++i) {
+        if (!less(*i, *(i - 1))) continue;
+        typename std::iterator_traits<RandomIt>::value_type key = std::move(*i);
+        RandomIt j = i;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j != first && less(key, *(j - 1)));
+        *j = std::move(key);
+    }
+}
+
+} // namespace quick_detail
+
+/**
+ * @brief Quick Sort over an iterator range
+ *
+ * The median of three is swapped to the front and used as the pivot in
+ * place, so the pivot is never copied and move-only types work. Recurses
+ * into the smaller side and loops on the larger one, which bounds the
+ * stack depth at O(log n); small ranges finish with insertion sort.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void quick_sort_custom(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    auto less = make_projected_compare(comp, proj);
+
+    while (last - first > 16) {
+        RandomIt mid = first + (last - first) / 2;
+        RandomIt back = last - 1;
+        if (less(*mid, *first)) std::iter_swap(mid, first);
+        if (less(*back, *mid)) std::iter_swap(back, mid);
+        if (less(*mid, *first)) std::iter_swap(mid, first);
+        std::iter_swap(first, mid);
+
+        // Hoare partition against *first; both scans stop on equal keys,
+        // so runs of duplicates split evenly
+        RandomIt i = first;
+        RandomIt j = last;
+        while (true) {
+            do { ++i; } while (i != last && less(*i, *first));
+            do { --j; } while (less(*first, *j));
+            if (i >= j) break;
+            std::iter_swap(i, j);
+        }
+        std::iter_swap(first, j);
+
+        if (j - first < last - (j + 1)) {
+            quick_sort_custom(first, j, comp, proj);
+            first = j + 1;
+        } else {
+            quick_sort_custom(j + 1, last, comp, proj);
+            last = j;
+        }
+    }
+    quick_detail::insertion_sort_range(first, last, less);
+}
+
 /**
  * @brief Quick Sort with custom comparator
  * @tparam T Type that supports comparison
@@ -316,21 +421,346 @@ void quick_sort_hybrid(std::vector<int>& arr, int low, int high, int cutoff = 10
 template <typename T, typename Compare>
 void quick_sort_custom(std::vector<T>& arr, int low, int high, Compare comp) {
     if (low < high) {
-        T pivot = arr[high];
-        int i = low - 1;
+        quick_sort_custom(arr.begin() + low, arr.begin() + high + 1, comp);
+    }
+}
+
+/**
+ * @brief Building blocks of quick_sort_pdq
+ *
+ * These work on raw pointers into the vector, [begin, end) half-open,
+ * which keeps the partition loops free of index arithmetic.
+ */
+namespace pdq_detail {
 
-        for (int j = low; j < high; ++j) {
-            if (comp(arr[j], pivot)) {
-                i++;
-                std::swap(arr[i], arr[j]);
+const ptrdiff_t insertion_sort_threshold = 24;  // Smaller ranges use insertion sort
+const ptrdiff_t ninther_threshold = 128;        // Larger ranges pick a ninther pivot
+const ptrdiff_t partial_insertion_limit = 8;    // Moves allowed before giving up
+const ptrdiff_t block_size = 64;                // Elements classified per block
+
+inline void sort2(int* a, int* b) {
+    if (*b < *a) std::swap(*a, *b);
+}
+
+inline void sort3(int* a, int* b, int* c) {
+    sort2(a, b);
+    sort2(b, c);
+    sort2(a, b);
+}
+
+/**
+ * @brief Insertion sort; unguarded assumes *(begin - 1) is <= every element
+ */
+template <bool Guarded>
+void insertion_sort(int* begin, int* end) {
+    for (int* cur = begin + 1; cur < end; ++cur) {
+        int value = *cur;
+        int* hole = cur;
+        if (Guarded) {
+            while (hole != begin && value < *(hole - 1)) {
+                *hole = *(hole - 1);
+                --hole;
+            }
+        } else {
+            while (value < *(hole - 1)) {
+                *hole = *(hole - 1);
+                --hole;
             }
         }
-        std::swap(arr[i + 1], arr[high]);
+        *hole = value;
+    }
+}
+
+/**
+ * @brief Insertion sort that gives up after partial_insertion_limit moves
+ * @return true if the range is now sorted
+ */
+bool partial_insertion_sort(int* begin, int* end) {
+    ptrdiff_t moves = 0;
+    for (int* cur = begin + 1; cur < end; ++cur) {
+        int value = *cur;
+        int* hole = cur;
+        while (hole != begin && value < *(hole - 1)) {
+            *hole = *(hole - 1);
+            --hole;
+        }
+        *hole = value;
 
-        int pivot_idx = i + 1;
-        quick_sort_custom(arr, low, pivot_idx - 1, comp);
-        quick_sort_custom(arr, pivot_idx + 1, high, comp);
+        moves += cur - hole;
+        if (moves > partial_insertion_limit) {
+            return false;
+        }
     }
+    return true;
+}
+
+/**
+ * @brief Exchange the misplaced elements found by one block step
+ *
+ * left + offsets_l[i] is >= pivot and right - offsets_r[i] is < pivot.
+ * When the counts differ a rotation (one move per element) replaces the
+ * swaps (three moves per pair).
+ */
+inline void swap_offsets(int* left, int* right, const unsigned char* offsets_l,
+                         const unsigned char* offsets_r, ptrdiff_t count, bool use_swaps) {
+    if (use_swaps) {
+        for (ptrdiff_t i = 0; i < count; ++i) {
+            std::swap(left[offsets_l[i]], *(right - offsets_r[i]));
+        }
+    } else if (count > 0) {
+        int* l = left + offsets_l[0];
+        int* r = right - offsets_r[0];
+        int tmp = *l;
+        *l = *r;
+        for (ptrdiff_t i = 1; i < count; ++i) {
+            l = left + offsets_l[i];
+            *r = *l;
+            r = right - offsets_r[i];
+            *l = *r;
+        }
+        *r = tmp;
+    }
+}
+
+/**
+ * @brief Branchless block partition (BlockQuicksort) around the pivot *begin
+ *
+ * Instead of branching on every comparison, each step scans a block of
+ * block_size elements from both ends and records, without branches, the
+ * offsets of the elements that are on the wrong side; the recorded pairs
+ * are then exchanged in bulk. Elements equal to the pivot go right.
+ *
+ * @param already_partitioned Output: no element had to move
+ * @return Final position of the pivot
+ */
+int* partition_right_block(int* begin, int* end, bool& already_partitioned) {
+    int pivot = *begin;
+    int* first = begin;
+    int* last = end;
+
+    // Median-of-three left an element >= pivot near the end, so this stops
+    while (*++first < pivot);
+
+    // Only the element at begin guards this scan when nothing was skipped
+    if (first - 1 == begin) {
+        while (first < last && !(*--last < pivot));
+    } else {
+        while (!(*--last < pivot));
+    }
+
+    already_partitioned = first >= last;
+    if (!already_partitioned) {
+        std::swap(*first, *last);
+        ++first;
+
+        unsigned char offsets_l[block_size];
+        unsigned char offsets_r[block_size];
+        ptrdiff_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (last - first > 2 * block_size) {
+            if (num_l == 0) {
+                start_l = 0;
+                int* it = first;
+                for (unsigned char i = 0; i < block_size; ++i, ++it) {
+                    offsets_l[num_l] = i;
+                    num_l += !(*it < pivot);
+                }
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                int* it = last;
+                for (unsigned char i = 1; i <= block_size; ++i) {
+                    offsets_r[num_r] = i;
+                    num_r += (*--it < pivot);
+                }
+            }
+
+            ptrdiff_t count = std::min(num_l, num_r);
+            swap_offsets(first, last, offsets_l + start_l, offsets_r + start_r, count, num_l == num_r);
+            num_l -= count;
+            num_r -= count;
+            start_l += count;
+            start_r += count;
+            if (num_l == 0) first += block_size;
+            if (num_r == 0) last -= block_size;
+        }
+
+        // Fewer than 2 blocks remain: size the last blocks to cover them
+        ptrdiff_t l_size, r_size;
+        ptrdiff_t unknown = (last - first) - ((num_r || num_l) ? block_size : 0);
+        if (num_r) {
+            l_size = unknown;
+            r_size = block_size;
+        } else if (num_l) {
+            l_size = block_size;
+            r_size = unknown;
+        } else {
+            l_size = unknown / 2;
+            r_size = unknown - l_size;
+        }
+
+        if (unknown && !num_l) {
+            start_l = 0;
+            int* it = first;
+            for (unsigned char i = 0; i < l_size; ++i, ++it) {
+                offsets_l[num_l] = i;
+                num_l += !(*it < pivot);
+            }
+        }
+        if (unknown && !num_r) {
+            start_r = 0;
+            int* it = last;
+            for (unsigned char i = 1; i <= r_size; ++i) {
+                offsets_r[num_r] = i;
+                num_r += (*--it < pivot);
+            }
+        }
+
+        ptrdiff_t count = std::min(num_l, num_r);
+        swap_offsets(first, last, offsets_l + start_l, offsets_r + start_r, count, num_l == num_r);
+        num_l -= count;
+        num_r -= count;
+        start_l += count;
+        start_r += count;
+        if (num_l == 0) first += l_size;
+        if (num_r == 0) last -= r_size;
+
+        // One side still has misplaced elements: move them to the boundary
+        if (num_l) {
+            while (num_l--) std::swap(first[offsets_l[start_l + num_l]], *--last);
+            first = last;
+        }
+        if (num_r) {
+            while (num_r--) std::swap(*(last - offsets_r[start_r + num_r]), *first), ++first;
+            last = first;
+        }
+    }
+
+    int* pivot_pos = first - 1;
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+    return pivot_pos;
+}
+
+/**
+ * @brief Sort [begin, end); leftmost means there is no element before begin
+ * @param depth_budget Partitions left before falling back to heap sort
+ */
+void pdq_loop(std::vector<int>& arr, int* begin, int* end, int depth_budget, bool leftmost) {
+    while (true) {
+        ptrdiff_t size = end - begin;
+
+        if (size < insertion_sort_threshold) {
+            if (leftmost) {
+                insertion_sort<true>(begin, end);
+            } else {
+                insertion_sort<false>(begin, end);
+            }
+            return;
+        }
+
+        if (depth_budget-- == 0) {
+            int low = static_cast<int>(begin - arr.data());
+            heap_sort_optimized(arr, low, low + static_cast<int>(size) - 1);
+            return;
+        }
+
+        // Pivot: median of three, or Tukey's ninther for larger ranges, moved to begin
+        ptrdiff_t half = size / 2;
+        if (size > ninther_threshold) {
+            sort3(begin, begin + half, end - 1);
+            sort3(begin + 1, begin + (half - 1), end - 2);
+            sort3(begin + 2, begin + (half + 1), end - 3);
+            sort3(begin + (half - 1), begin + half, begin + (half + 1));
+            std::swap(*begin, *(begin + half));
+        } else {
+            sort3(begin + half, begin, end - 1);
+        }
+
+        // The element before this range is <= everything in it. If it equals
+        // the pivot, the pivot is the minimum and probably heavily repeated:
+        // split off all copies with a three-way partition and never revisit them.
+        if (!leftmost && !(*(begin - 1) < *begin)) {
+            int low = static_cast<int>(begin - arr.data());
+            int lt, gt;
+            partition_three_way(arr, low, low + static_cast<int>(size) - 1, lt, gt);
+            begin = arr.data() + gt + 1;
+            continue;
+        }
+
+        bool already_partitioned;
+        int* pivot_pos = partition_right_block(begin, end, already_partitioned);
+
+        ptrdiff_t l_size = pivot_pos - begin;
+        ptrdiff_t r_size = end - (pivot_pos + 1);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            // Break up patterns that fool the pivot choice (e.g. organ pipes)
+            if (l_size >= insertion_sort_threshold) {
+                std::swap(*begin, *(begin + l_size / 4));
+                std::swap(*(pivot_pos - 1), *(pivot_pos - l_size / 4));
+            }
+            if (r_size >= insertion_sort_threshold) {
+                std::swap(*(pivot_pos + 1), *(pivot_pos + 1 + r_size / 4));
+                std::swap(*(end - 1), *(end - r_size / 4));
+            }
+        } else if (already_partitioned &&
+                   partial_insertion_sort(begin, pivot_pos) &&
+                   partial_insertion_sort(pivot_pos + 1, end)) {
+            return;  // Input was (nearly) sorted
+        }
+
+        // Recurse into the smaller side, loop on the larger one
+        if (l_size < r_size) {
+            pdq_loop(arr, begin, pivot_pos, depth_budget, leftmost);
+            begin = pivot_pos + 1;
+            leftmost = false;
+        } else {
+            pdq_loop(arr, pivot_pos + 1, end, depth_budget, false);
+            end = pivot_pos;
+        }
+    }
+}
+
+}  // namespace pdq_detail
+
+/**
+ * @brief Pattern-defeating Quick Sort (introsort + BlockQuicksort + pdqsort)
+ *
+ * Combines the pieces above into one quick sort that cannot go quadratic:
+ * - Pivot: median of three, or Tukey's ninther (median of three medians)
+ *   for ranges over 128 elements
+ * - Partition: branchless block partition, so random data causes no
+ *   branch mispredictions while classifying elements
+ * - Worst-case guard: once the partition depth exceeds 2 * log2(n), the
+ *   remaining range is sorted with heap_sort_optimized (introsort), and
+ *   highly unbalanced partitions shuffle a few elements to break patterns
+ * - Sorted input: a partition that moved nothing is followed by a bounded
+ *   insertion sort, so sorted and nearly sorted input finish in O(n)
+ * - Duplicates: when the pivot equals the element before the range, every
+ *   copy of it is split off with partition_three_way (the partition of
+ *   quick_sort_three_way), so inputs with few distinct keys run in O(n k)
+ * - Small ranges: insertion sort, unguarded whenever a smaller element is
+ *   known to sit just before the range
+ *
+ * Time Complexity:
+ * - Best Case: O(n) - sorted, reverse sorted or all-equal input
+ * - Average Case: O(n log n)
+ * - Worst Case: O(n log n)
+ *
+ * Space Complexity: O(log n) - always recurses into the smaller side
+ *
+ * @param arr Vector to be sorted
+ */
+void quick_sort_pdq(std::vector<int>& arr) {
+    if (arr.size() < 2) return;
+
+    int depth_budget = 0;
+    for (size_t n = arr.size(); n > 1; n >>= 1) {
+        depth_budget += 2;  // 2 * floor(log2(n))
+    }
+    pdq_detail::pdq_loop(arr, arr.data(), arr.data() + arr.size(), depth_budget, true);
 }
 
 /**
@@ -360,16 +790,22 @@ int quick_select(std::vector<int>& arr, int low, int high, int k) {
 }
 
 /**
- * @brief Wrapper function for quick select
+ * @brief Find kth smallest element without modifying the input
+ *
+ * Works on a copy with select_nth (introselect), so sorted or
+ * duplicate-heavy inputs no longer hit quick_select's O(n²) worst case.
+ * Call select_nth directly to select in place and skip the copy.
+ *
  * @param arr Vector to search in
  * @param k Position (1-based) to find
  * @return kth smallest element
  */
-int find_kth_smallest_quick(std::vector<int> arr, int k) {
+int find_kth_smallest_quick(const std::vector<int>& arr, int k) {
     if (k < 1 || k > arr.size()) {
         throw std::out_of_range("k is out of bounds");
     }
-    return quick_select(arr, 0, arr.size() - 1, k);
+    std::vector<int> copy = arr;
+    return select_nth(copy, k - 1);
 }
 
 /**
@@ -515,6 +951,47 @@ void demonstrate_worst_case() {
     std::cout << "Median of three quick sort: " << time3.count() << " μs" << std::endl;
 }
 
+/**
+ * @brief Compare quick_sort_pdq with std::sort on random and adversarial inputs
+ */
+void compare_quick_sort_pdq(int n = 1000000) {
+    std::vector<int> random_data(n), sorted_data(n), reversed(n), organ_pipe(n), few_keys(n), sawtooth(n);
+    for (int i = 0; i < n; ++i) {
+        random_data[i] = rand();
+        sorted_data[i] = i;
+        reversed[i] = n - i;
+        organ_pipe[i] = i < n / 2 ? i : n - i;
+        few_keys[i] = rand() % 8;
+        sawtooth[i] = i % 1000;
+    }
+
+    std::cout << "\n=== quick_sort_pdq vs std::sort (" << n << " elements) ===" << std::endl;
+
+    auto run = [](const std::string& name, const std::vector<int>& data) {
+        auto arr1 = data;
+        auto start = std::chrono::high_resolution_clock::now();
+        quick_sort_pdq(arr1);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto time1 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        auto arr2 = data;
+        start = std::chrono::high_resolution_clock::now();
+        std::sort(arr2.begin(), arr2.end());
+        end = std::chrono::high_resolution_clock::now();
+        auto time2 = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        std::cout << name << ": quick_sort_pdq " << time1.count() << " μs, std::sort "
+                  << time2.count() << " μs" << (arr1 == arr2 ? "" : " (MISMATCH)") << std::endl;
+    };
+
+    run("Random        ", random_data);
+    run("Sorted        ", sorted_data);
+    run("Reverse sorted", reversed);
+    run("Organ pipe    ", organ_pipe);
+    run("8 distinct    ", few_keys);
+    run("Sawtooth      ", sawtooth);
+}
+
 /**
  * @brief Test quick select algorithm
  */
@@ -1,6 +1,12 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "00-Heap Utilities.cpp"  // heapify_dary, heap_sift_up_dary, build_heap_dary
+#include "00-Sort Utilities.cpp"  // identity_projection, make_projected_compare
 
 /**
  * @brief Heap Sort Implementation
@@ -210,107 +216,138 @@ void heap_sort_optimized(std::vector<int>& arr) {
 }
 
 /**
- * @brief Generic Heap Sort for any comparable type
- * @tparam T Type that supports comparison operators
- * @param arr Vector to be sorted
- * @param ascending Sort order (true for ascending, false for descending)
+ * @brief Heap Sort of arr[low..high] in place
+ *
+ * Same bottom-up build and extraction as heap_sort_optimized, on a heap
+ * rooted at arr[low]. Sifting moves a hole down instead of swapping at
+ * every level. quick_sort_pdq uses this as its O(n log n) fallback.
+ *
+ * @param arr Vector holding the range
+ * @param low Starting index
+ * @param high Ending index
  */
-template <typename T>
-void heap_sort_generic(std::vector<T>& arr, bool ascending = true) {
-    int n = arr.size();
+void heap_sort_optimized(std::vector<int>& arr, int low, int high) {
+    int n = high - low + 1;
+    if (n < 2) return;
+    int* base = arr.data() + low;
 
-    // Build heap (max heap for ascending, min heap for descending)
-    for (int i = n / 2 - 1; i >= 0; --i) {
-        if (ascending) {
-            // Build max heap
-            int largest = i;
-            while (true) {
-                int left = 2 * largest + 1;
-                int right = 2 * largest + 2;
-                int max_idx = largest;
-
-                if (left < n && arr[left] > arr[max_idx]) {
-                    max_idx = left;
-                }
-                if (right < n && arr[right] > arr[max_idx]) {
-                    max_idx = right;
-                }
-
-                if (max_idx != largest) {
-                    std::swap(arr[largest], arr[max_idx]);
-                    largest = max_idx;
-                } else {
-                    break;
-                }
-            }
+    auto sift_down = [base](int size, int i) {
+        int value = base[i];
+        while (true) {
+            int child = 2 * i + 1;
+            if (child >= size) break;
+            if (child + 1 < size && base[child] < base[child + 1]) child++;
+            if (!(value < base[child])) break;
+            base[i] = base[child];
+            i = child;
         }
-    }
+        base[i] = value;
+    };
 
-    // Extract elements
+    for (int i = n / 2 - 1; i >= 0; --i) {
+        sift_down(n, i);
+    }
     for (int i = n - 1; i > 0; --i) {
-        std::swap(arr[0], arr[i]);
+        std::swap(base[0], base[i]);
+        sift_down(i, 0);
+    }
+}
 
-        // Heapify reduced heap
-        int root = 0;
-        while (true) {
-            int left = 2 * root + 1;
-            int right = 2 * root + 2;
-            int extreme_idx = root;
-
-            if (ascending) {
-                // Max heap for ascending order
-                if (left < i && arr[left] > arr[extreme_idx]) {
-                    extreme_idx = left;
-                }
-                if (right < i && arr[right] > arr[extreme_idx]) {
-                    extreme_idx = right;
-                }
-            } else {
-                // Min heap for descending order
-                if (left < i && arr[left] < arr[extreme_idx]) {
-                    extreme_idx = left;
-                }
-                if (right < i && arr[right] < arr[extreme_idx]) {
-                    extreme_idx = right;
-                }
-            }
-
-            if (extreme_idx != root) {
-                std::swap(arr[root], arr[extreme_idx]);
-                root = extreme_idx;
-            } else {
-                break;
-            }
+namespace heap_detail {
+
+/**
+ * @brief Sift the element at hole down a binary heap of n elements
+ *
+ * The value is held aside while larger children move up into the hole,
+ * so each level costs one move instead of a three-move swap.
+ */
+template <typename RandomIt, typename Distance, typename Less>
+void sift_down_hole(RandomIt first, Distance hole, Distance n, Less& less) {
+    typename std::iterator_traits<RandomIt>::value_type value = std::move(first[hole]);
+    while (true) {
+        Distance child = 2 * hole + 1;
+        if (child >= n) break;
+        if (child + 1 < n && less(first[child], first[child + 1])) {
+            ++child;
         }
+        if (!less(value, first[child])) break;
+        first[hole] = std::move(first[child]);
+        hole = child;
+    }
+    first[hole] = std::move(value);
+}
+
+} // namespace heap_detail
+
+/**
+ * @brief Heap Sort over an iterator range
+ *
+ * Elements are only moved and swapped, so move-only types work.
+ *
+ * @param first Start of the range
+ * @param last End of the range
+ * @param comp Strict weak ordering on projected values
+ * @param proj Projection applied to each element before comparing
+ */
+template <typename RandomIt, typename Compare = std::less<>, typename Projection = identity_projection>
+void heap_sort_generic(RandomIt first, RandomIt last, Compare comp = Compare(), Projection proj = Projection()) {
+    using Distance = typename std::iterator_traits<RandomIt>::difference_type;
+    auto less = make_projected_compare(comp, proj);
+    Distance n = last - first;
+    if (n <= 1) return;
+
+    for (Distance i = n / 2; i-- > 0;) {
+        heap_detail::sift_down_hole(first, i, n, less);
+    }
+    for (Distance i = n - 1; i > 0; --i) {
+        std::iter_swap(first, first + i);
+        heap_detail::sift_down_hole(first, Distance(0), i, less);
+    }
+}
+
+/**
+ * @brief Generic Heap Sort for any comparable type
+ * @tparam T Type that supports comparison operators
+ * @param arr Vector to be sorted
+ * @param ascending Sort order (true for ascending, false for descending)
+ */
+template <typename T>
+void heap_sort_generic(std::vector<T>& arr, bool ascending = true) {
+    if (ascending) {
+        heap_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b > a; });
+    } else {
+        heap_sort_generic(arr.begin(), arr.end(), [](const T& a, const T& b) { return b < a; });
     }
 }
 
 /**
- * @brief Find kth largest element using heap sort approach
+ * @brief Find kth largest element with a bounded min heap
+ *
+ * Keeps only the k largest elements seen so far in a min heap, so the root
+ * is the kth largest at the end. O(n log k) time and O(k) extra space
+ * instead of building a heap over the whole array. TopK in Selection
+ * generalizes this to any type, comparator and streaming input.
+ *
  * @param arr Vector to search in
  * @param k Position (1-based) from largest
  * @return kth largest element
  */
-int find_kth_largest_heap(std::vector<int> arr, int k) {
+int find_kth_largest_heap(const std::vector<int>& arr, int k) {
     if (k < 1 || k > arr.size()) {
         throw std::out_of_range("k is out of bounds");
     }
 
-    int n = arr.size();
-
-    // Build max heap
-    for (int i = n / 2 - 1; i >= 0; --i) {
-        heapify(arr, n, i);
-    }
+    std::vector<int> heap(arr.begin(), arr.begin() + k);
+    build_heap_dary<2>(heap, std::greater<int>());
 
-    // Extract k-1 largest elements
-    for (int i = n - 1; i > n - k; --i) {
-        std::swap(arr[0], arr[i]);
-        heapify(arr, i, 0);
+    for (size_t i = k; i < arr.size(); ++i) {
+        if (arr[i] > heap[0]) {
+            heap[0] = arr[i];
+            heapify_dary<2>(heap, heap.size(), 0, std::greater<int>());
+        }
     }
 
-    // Return kth largest (now at root)
-    return arr[0];
+    return heap[0];
 }
 
 /**
@@ -415,7 +452,7 @@ void test_heap_sort() {
 /**
  * @brief Performance comparison with other sorting algorithms
  */
-void compare_sorting_performance() {
+void compare_heap_sort_performance() {
     // Generate test data
     std::vector<int> test_data(10000);
     for (int i = 0; i < 10000; ++i) {
@@ -1,6 +1,16 @@
 #pragma once
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief Counting Sort Implementation
@@ -64,6 +74,49 @@ void counting_sort_basic(std::vector<int>& arr, int max_val) {
     }
 }
 
+/**
+ * @brief One stable counting pass: scatter src into dst ordered by bucket
+ *
+ * This is the core of counting_sort_stable, generalized so radix sort can
+ * run it once per digit:
+ * 1. count[b] = number of elements whose bucket is b (skipped when the
+ *    caller already has the histogram)
+ * 2. Exclusive prefix sum: count[b] = first output slot of bucket b
+ * 3. Scatter left to right, so equal buckets keep their input order
+ *
+ * Elements are moved, not copied, so sorting strings or records never
+ * deep-copies them; src is left holding moved-from elements.
+ *
+ * @param src Input elements (moved from)
+ * @param dst Output, same size as src (must not overlap it)
+ * @param n Number of elements
+ * @param bucket_of Maps an element to a bucket in [0, count.size())
+ * @param count Histogram buffer, one entry per bucket
+ * @param have_histogram count already holds the histogram of src
+ */
+template <typename T, typename BucketOf>
+void counting_sort_pass(T* src, T* dst, size_t n, BucketOf bucket_of,
+                        std::vector<size_t>& count, bool have_histogram = false) {
+    if (!have_histogram) {
+        std::fill(count.begin(), count.end(), 0);
+        for (size_t i = 0; i < n; ++i) {
+            count[bucket_of(src[i])]++;
+        }
+    }
+
+    size_t position = 0;
+    for (size_t& c : count) {
+        size_t bucket_size = c;
+        c = position;
+        position += bucket_size;
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        size_t slot = count[bucket_of(src[i])]++;  // Bucket read before src[i] is moved from
+        dst[slot] = std::move(src[i]);
+    }
+}
+
 /**
  * @brief Stable Counting Sort implementation
  * Maintains relative order of equal elements
@@ -74,33 +127,31 @@ void counting_sort_stable(std::vector<int>& arr, int max_val) {
     int n = arr.size();
     if (n == 0) return;
 
-    // Create count array
-    std::vector<int> count(max_val + 1, 0);
-
-    // Store count of each element
-    for (int i = 0; i < n; ++i) {
-        count[arr[i]]++;
-    }
+    // One bucket per value, then a single stable pass
+    std::vector<size_t> count(max_val + 1, 0);
+    std::vector<int> output(n);
+    counting_sort_pass(arr.data(), output.data(), n, [](int value) { return value; }, count);
 
-    // Change count[i] so that count[i] contains actual position
-    // of this element in output array
-    for (int i = 1; i <= max_val; ++i) {
-        count[i] += count[i - 1];
-    }
+    arr = std::move(output);
+}
 
-    // Build output array (work from right to left for stability)
-    std::vector<int> output(n);
-    for (int i = n - 1; i >= 0; --i) {
-        output[count[arr[i]] - 1] = arr[i];
-        count[arr[i]]--;
-    }
+/**
+ * @brief Memory guard shared by the counting sorts
+ *
+ * A count array of range entries is only worth allocating when it is not
+ * much larger than the input: beyond max_range_per_element counters per
+ * element (plus a small constant for tiny inputs) the histogram costs
+ * more memory and time than the sort itself.
+ */
+const uint64_t max_range_per_element = 4;
 
-    // Copy output array to arr
-    for (int i = 0; i < n; ++i) {
-        arr[i] = output[i];
-    }
+bool counting_range_too_large(uint64_t range, size_t n) {
+    return range > max_range_per_element * n + 1024;
 }
 
+template <size_t DigitBits = 11, typename T>
+void radix_sort_lsd(std::vector<T>& arr);
+
 /**
  * @brief Counting Sort with automatic range detection
  * Automatically finds min and max values
@@ -118,7 +169,13 @@ void counting_sort_auto_range(std::vector<int>& arr) {
         max_val = std::max(max_val, arr[i]);
     }
 
-    int range = max_val - min_val + 1;
+    // A wide spread would allocate a huge count array: radix sort instead
+    long long wide_range = static_cast<long long>(max_val) - min_val + 1;
+    if (counting_range_too_large(static_cast<uint64_t>(wide_range), n)) {
+        radix_sort_lsd(arr);
+        return;
+    }
+    int range = static_cast<int>(wide_range);
 
     // Create count array
     std::vector<int> count(range, 0);
@@ -393,6 +450,573 @@ void counting_sort_pairs(std::vector<std::pair<int, int>>& arr) {
     }
 }
 
+/**
+ * @brief Order-preserving map from a key type to unsigned bits
+ *
+ * Radix sort orders the bits as unsigned integers, so every key type is
+ * mapped to an unsigned value of the same width whose order matches the
+ * key's order:
+ * - Unsigned integers are used as is
+ * - Signed integers flip the sign bit, so negatives sort first
+ * - IEEE floats flip just the sign bit of non-negative values and every
+ *   bit of negative ones (whose magnitude order is reversed).
+ *   -0.0 sorts just before +0.0, and NaNs sort beyond the infinities on
+ *   the side of their sign bit.
+ */
+template <typename T>
+struct RadixKey;
+
+template <>
+struct RadixKey<uint32_t> {
+    using Bits = uint32_t;
+    static Bits to_bits(uint32_t key) { return key; }
+};
+
+template <>
+struct RadixKey<int32_t> {
+    using Bits = uint32_t;
+    static Bits to_bits(int32_t key) { return static_cast<uint32_t>(key) ^ 0x80000000U; }
+};
+
+template <>
+struct RadixKey<uint64_t> {
+    using Bits = uint64_t;
+    static Bits to_bits(uint64_t key) { return key; }
+};
+
+template <>
+struct RadixKey<int64_t> {
+    using Bits = uint64_t;
+    static Bits to_bits(int64_t key) { return static_cast<uint64_t>(key) ^ (1ULL << 63); }
+};
+
+template <>
+struct RadixKey<float> {
+    using Bits = uint32_t;
+    static Bits to_bits(float key) {
+        uint32_t bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return (bits & 0x80000000U) ? ~bits : (bits | 0x80000000U);
+    }
+};
+
+template <>
+struct RadixKey<double> {
+    using Bits = uint64_t;
+    static Bits to_bits(double key) {
+        uint64_t bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        return (bits & (1ULL << 63)) ? ~bits : (bits | (1ULL << 63));
+    }
+};
+
+/**
+ * @brief LSD radix sort of records by an extracted numeric key
+ *
+ * Runs one counting_sort_pass per DigitBits-bit digit of the key, least
+ * significant digit first; each pass is stable, so after the last one the
+ * records are ordered by the whole key. Details:
+ * - All digit histograms are built in one read of the input
+ * - A digit whose histogram puts every record in one bucket is skipped
+ *   (e.g. the high digits of small values, or the sign digit of
+ *   all-positive input)
+ * - Passes alternate between arr and one buffer; at most one final move
+ *
+ * DigitBits trades passes for histogram size: 8 bits (256 counters) suits
+ * small inputs, 11 bits sorts 32-bit keys in 3 passes with a 16 KB
+ * histogram, 16 bits sorts 64-bit keys in 4 passes.
+ *
+ * Time Complexity: O(p (n + 2^DigitBits)) for p = ceil(key bits / DigitBits)
+ * Space Complexity: O(n + p 2^DigitBits)
+ * Stable: Yes
+ *
+ * @tparam DigitBits Bits per digit: 8, 11 or 16
+ * @param arr Records to be sorted
+ * @param key Extracts a uint32/int32/uint64/int64/float/double key from a record
+ */
+template <size_t DigitBits = 11, typename Record, typename KeyOf>
+void radix_sort_lsd_by(std::vector<Record>& arr, KeyOf key) {
+    static_assert(DigitBits == 8 || DigitBits == 11 || DigitBits == 16, "Digits are 8, 11 or 16 bits");
+    using Key = typename std::decay<decltype(key(arr[0]))>::type;
+    using Bits = typename RadixKey<Key>::Bits;
+
+    const size_t n = arr.size();
+    if (n < 2) return;
+
+    constexpr size_t key_bits = sizeof(Bits) * 8;
+    constexpr size_t passes = (key_bits + DigitBits - 1) / DigitBits;
+    constexpr size_t buckets = size_t(1) << DigitBits;
+    constexpr Bits digit_mask = static_cast<Bits>(buckets - 1);
+
+    // Histograms of every digit in a single pass over the input
+    std::vector<std::vector<size_t>> histograms(passes, std::vector<size_t>(buckets, 0));
+    for (size_t i = 0; i < n; ++i) {
+        Bits bits = RadixKey<Key>::to_bits(key(arr[i]));
+        for (size_t p = 0; p < passes; ++p) {
+            histograms[p][(bits >> (p * DigitBits)) & digit_mask]++;
+        }
+    }
+
+    std::vector<Record> buffer(n);
+    Record* src = arr.data();
+    Record* dst = buffer.data();
+
+    for (size_t p = 0; p < passes; ++p) {
+        std::vector<size_t>& count = histograms[p];
+        if (std::find(count.begin(), count.end(), n) != count.end()) {
+            continue;  // Every record has the same digit: the pass would not move anything
+        }
+
+        size_t shift = p * DigitBits;
+        counting_sort_pass(src, dst, n, [&key, shift, digit_mask](const Record& record) {
+            return static_cast<size_t>((RadixKey<Key>::to_bits(key(record)) >> shift) & digit_mask);
+        }, count, true);
+        std::swap(src, dst);
+    }
+
+    if (src != arr.data()) {
+        std::move(src, src + n, arr.data());
+    }
+}
+
+/**
+ * @brief LSD radix sort for uint32/int32/uint64/int64/float/double vectors
+ */
+template <size_t DigitBits, typename T>
+void radix_sort_lsd(std::vector<T>& arr) {
+    radix_sort_lsd_by<DigitBits>(arr, [](T value) { return value; });
+}
+
+/**
+ * @brief Recursive step of radix_sort_msd_by: sort [begin, end) from character depth on
+ */
+template <typename Record, typename KeyOf>
+void radix_sort_msd_range(Record* data, Record* buffer, size_t begin, size_t end, size_t depth, KeyOf& key) {
+    const size_t small_range = 32;
+
+    while (end - begin > 1) {
+        if (end - begin < small_range) {
+            // Few records: compare the remaining suffixes directly
+            std::sort(data + begin, data + end, [&key, depth](const Record& a, const Record& b) {
+                const std::string& ka = key(a);
+                const std::string& kb = key(b);
+                return ka.compare(std::min(depth, ka.size()), std::string::npos,
+                                  kb, std::min(depth, kb.size()), std::string::npos) < 0;
+            });
+            return;
+        }
+
+        // Bucket 0 holds keys that end before depth, bucket c + 1 holds character c
+        auto bucket_of = [&key, depth](const Record& record) {
+            const std::string& k = key(record);
+            return depth < k.size() ? static_cast<size_t>(static_cast<unsigned char>(k[depth])) + 1 : 0;
+        };
+
+        std::vector<size_t> count(257, 0);
+        for (size_t i = begin; i < end; ++i) {
+            count[bucket_of(data[i])]++;
+        }
+        std::vector<size_t> sizes = count;
+
+        if (std::find(count.begin() + 1, count.end(), end - begin) != count.end()) {
+            depth++;  // Shared character: nothing to scatter, look at the next one
+            continue;
+        }
+
+        counting_sort_pass(data + begin, buffer + begin, end - begin, bucket_of, count, true);
+        std::move(buffer + begin, buffer + end, data + begin);
+
+        // Keys that ended are already in place; recurse into every character bucket
+        size_t start = begin + sizes[0];
+        for (size_t c = 1; c < 257; ++c) {
+            if (sizes[c] > 1) {
+                radix_sort_msd_range(data, buffer, start, start + sizes[c], depth + 1, key);
+            }
+            start += sizes[c];
+        }
+        return;
+    }
+}
+
+/**
+ * @brief MSD radix sort of records by an extracted std::string key
+ *
+ * Distributes records by their first character with a stable
+ * counting_sort_pass, then recursively sorts each bucket by the next
+ * character. Runs of records sharing a prefix skip the scatter entirely,
+ * and buckets smaller than 32 records finish with a comparison sort on
+ * the remaining suffix. Keys compare as unsigned bytes, like std::string.
+ *
+ * Time Complexity: O(D + n) where D is the total length of distinguishing prefixes
+ * Space Complexity: O(n) buffer
+ * Stable: No (the small-bucket comparison sort is not stable)
+ *
+ * @param arr Records to be sorted
+ * @param key Returns a const std::string& key for a record
+ */
+template <typename Record, typename KeyOf>
+void radix_sort_msd_by(std::vector<Record>& arr, KeyOf key) {
+    if (arr.size() < 2) return;
+    std::vector<Record> buffer(arr.size());
+    radix_sort_msd_range(arr.data(), buffer.data(), 0, arr.size(), 0, key);
+}
+
+/**
+ * @brief MSD radix sort for strings
+ */
+void radix_sort_msd(std::vector<std::string>& arr) {
+    radix_sort_msd_by(arr, [](const std::string& s) -> const std::string& { return s; });
+}
+
+/**
+ * @brief Radix sort for pairs by first element, then second element
+ *
+ * Unlike counting_sort_pairs this needs no count array sized to the
+ * values, and it accepts negative numbers: both fields are packed into one
+ * 64-bit key.
+ */
+void radix_sort_pairs(std::vector<std::pair<int, int>>& arr) {
+    radix_sort_lsd_by(arr, [](const std::pair<int, int>& p) {
+        return (static_cast<uint64_t>(RadixKey<int32_t>::to_bits(p.first)) << 32) |
+               RadixKey<int32_t>::to_bits(p.second);
+    });
+}
+
+/**
+ * @brief Does RadixKey<K> exist, i.e. can radix_sort_lsd_by sort by K?
+ */
+template <typename K, typename = void>
+struct has_radix_key : std::false_type {};
+
+template <typename K>
+struct has_radix_key<K, std::void_t<typename RadixKey<K>::Bits>> : std::true_type {};
+
+/**
+ * @brief Run fn(thread, begin, end) on num_threads threads over [0, n) split evenly
+ */
+template <typename Fn>
+void parallel_chunks(size_t n, size_t num_threads, Fn fn) {
+    if (num_threads <= 1) {
+        fn(0, 0, n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_threads; ++t) {
+        threads.emplace_back([&fn, t, n, num_threads] {
+            fn(t, n * t / num_threads, n * (t + 1) / num_threads);
+        });
+    }
+    fn(0, 0, n / num_threads);  // The calling thread takes chunk 0
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Threads worth using for a pass over n elements (at least 64K each)
+ */
+size_t counting_sort_threads(size_t n, size_t requested) {
+    const size_t min_elements_per_thread = 1 << 16;
+    return std::max<size_t>(1, std::min(requested, n / min_elements_per_thread));
+}
+
+/**
+ * @brief Smallest and largest key, one chunk per thread
+ */
+template <typename Record, typename KeyOf, typename Key>
+void parallel_min_max(const std::vector<Record>& arr, KeyOf key, size_t num_threads, Key& min_key, Key& max_key) {
+    std::vector<Key> mins(num_threads), maxs(num_threads);
+    parallel_chunks(arr.size(), num_threads, [&](size_t t, size_t begin, size_t end) {
+        Key lo = key(arr[begin]), hi = lo;
+        for (size_t i = begin + 1; i < end; ++i) {
+            Key k = key(arr[i]);
+            lo = std::min(lo, k);
+            hi = std::max(hi, k);
+        }
+        mins[t] = lo;
+        maxs[t] = hi;
+    });
+    min_key = *std::min_element(mins.begin(), mins.end());
+    max_key = *std::max_element(maxs.begin(), maxs.end());
+}
+
+/**
+ * @brief Per-thread histograms of key(arr[i]) - min_key over [0, range)
+ *
+ * Thread t counts its own contiguous chunk of arr into histograms[t], so
+ * threads never share a counter (and never need atomics). This is the
+ * histogram pass of parallel_counting_sort_by, usable on its own for
+ * bucketed aggregation: the bucket totals are the column sums.
+ *
+ * @return histograms[t][b] = records of chunk t whose key is min_key + b
+ */
+template <typename Record, typename KeyOf, typename Key>
+std::vector<std::vector<size_t>> parallel_histograms(const std::vector<Record>& arr, KeyOf key,
+                                                     Key min_key, size_t range, size_t num_threads) {
+    std::vector<std::vector<size_t>> histograms(num_threads);
+    parallel_chunks(arr.size(), num_threads, [&](size_t t, size_t begin, size_t end) {
+        std::vector<size_t>& count = histograms[t];
+        count.assign(range, 0);  // Allocated by the thread that uses it
+        for (size_t i = begin; i < end; ++i) {
+            count[static_cast<size_t>(key(arr[i]) - min_key)]++;
+        }
+    });
+    return histograms;
+}
+
+/**
+ * @brief Bucket totals of key(arr[i]) - min_key, with the counting done in parallel
+ */
+template <typename Record, typename KeyOf, typename Key>
+std::vector<size_t> parallel_histogram(const std::vector<Record>& arr, KeyOf key, Key min_key, size_t range,
+                                       size_t num_threads = std::thread::hardware_concurrency()) {
+    num_threads = counting_sort_threads(arr.size(), num_threads);
+    std::vector<std::vector<size_t>> histograms = parallel_histograms(arr, key, min_key, range, num_threads);
+
+    std::vector<size_t> total = std::move(histograms[0]);
+    parallel_chunks(range, counting_sort_threads(range, num_threads), [&](size_t, size_t begin, size_t end) {
+        for (size_t t = 1; t < histograms.size(); ++t) {
+            for (size_t b = begin; b < end; ++b) {
+                total[b] += histograms[t][b];
+            }
+        }
+    });
+    return total;
+}
+
+/**
+ * @brief Parallel stable counting sort of records by an integer key
+ *
+ * 1. Min/max of the keys, one chunk per thread
+ * 2. Memory guard: if the key range is much larger than n (see
+ *    counting_range_too_large), or the per-thread histograms would exceed
+ *    max_histogram_bytes, falls back to radix_sort_lsd_by (for keys
+ *    RadixKey supports) or std::stable_sort
+ * 3. Per-thread private histograms (parallel_histograms)
+ * 4. Prefix sum in bucket-major, thread-minor order, itself split across
+ *    threads by bucket range: histograms[t][b] becomes the first output
+ *    slot for chunk t's records with bucket b
+ * 5. Parallel scatter into a preallocated output: every thread walks its
+ *    chunk left to right and writes to its own slots, so the result is
+ *    stable without any synchronization
+ *
+ * Time Complexity: O((n + k t) / t) with t threads and k = key range
+ * Space Complexity: O(n + k t)
+ * Stable: Yes
+ *
+ * @param arr Records to be sorted
+ * @param key Returns an integer key for a record
+ * @param num_threads Threads to use (fewer for small inputs)
+ * @param max_histogram_bytes Largest total size of the per-thread histograms
+ */
+template <typename Record, typename KeyOf>
+void parallel_counting_sort_by(std::vector<Record>& arr, KeyOf key,
+                               size_t num_threads = std::thread::hardware_concurrency(),
+                               size_t max_histogram_bytes = size_t(256) << 20) {
+    using Key = typename std::decay<decltype(key(arr[0]))>::type;
+    static_assert(std::is_integral<Key>::value, "parallel_counting_sort_by needs integer keys");
+
+    const size_t n = arr.size();
+    if (n < 2) return;
+    num_threads = counting_sort_threads(n, num_threads);
+
+    // Phase 1: key range
+    Key min_key, max_key;
+    parallel_min_max(arr, key, num_threads, min_key, max_key);
+    uint64_t range = static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key) + 1;
+
+    // Phase 2: memory guard
+    if (range == 0 || counting_range_too_large(range, n) ||
+        range * num_threads > max_histogram_bytes / sizeof(size_t)) {
+        if constexpr (has_radix_key<Key>::value) {
+            radix_sort_lsd_by(arr, key);
+        } else {
+            std::stable_sort(arr.begin(), arr.end(), [&key](const Record& a, const Record& b) {
+                return key(a) < key(b);
+            });
+        }
+        return;
+    }
+
+    // Phase 3: private histograms
+    std::vector<std::vector<size_t>> histograms = parallel_histograms(arr, key, min_key, range, num_threads);
+
+    // Phase 4: prefix sum, split by bucket range
+    size_t buckets = static_cast<size_t>(range);
+    size_t prefix_threads = counting_sort_threads(buckets, num_threads);
+    std::vector<size_t> chunk_totals(prefix_threads + 1, 0);
+    parallel_chunks(buckets, prefix_threads, [&](size_t c, size_t begin, size_t end) {
+        size_t total = 0;
+        for (size_t b = begin; b < end; ++b) {
+            for (size_t t = 0; t < num_threads; ++t) {
+                total += histograms[t][b];
+            }
+        }
+        chunk_totals[c + 1] = total;
+    });
+    for (size_t c = 1; c <= prefix_threads; ++c) {
+        chunk_totals[c] += chunk_totals[c - 1];
+    }
+    parallel_chunks(buckets, prefix_threads, [&](size_t c, size_t begin, size_t end) {
+        size_t position = chunk_totals[c];
+        for (size_t b = begin; b < end; ++b) {
+            for (size_t t = 0; t < num_threads; ++t) {
+                size_t count = histograms[t][b];
+                histograms[t][b] = position;
+                position += count;
+            }
+        }
+    });
+
+    // Phase 5: stable parallel scatter
+    std::vector<Record> output(n);
+    parallel_chunks(n, num_threads, [&](size_t t, size_t begin, size_t end) {
+        std::vector<size_t>& next = histograms[t];
+        for (size_t i = begin; i < end; ++i) {
+            output[next[static_cast<size_t>(key(arr[i]) - min_key)]++] = std::move(arr[i]);
+        }
+    });
+
+    arr = std::move(output);
+}
+
+/**
+ * @brief Parallel counting sort for integers
+ *
+ * Plain integers carry nothing but their key, so instead of scattering
+ * (as parallel_counting_sort_by must, for stability) the output is
+ * regenerated from the merged histogram: each thread fills the values of
+ * its own bucket range, starting at that range's prefix-sum offset.
+ * Falls back to radix_sort_lsd under the same memory guard.
+ */
+void parallel_counting_sort(std::vector<int>& arr, size_t num_threads = std::thread::hardware_concurrency(),
+                            size_t max_histogram_bytes = size_t(256) << 20) {
+    const size_t n = arr.size();
+    if (n < 2) return;
+    num_threads = counting_sort_threads(n, num_threads);
+    auto identity = [](int value) { return value; };
+
+    int min_key, max_key;
+    parallel_min_max(arr, identity, num_threads, min_key, max_key);
+    uint64_t range = static_cast<uint64_t>(static_cast<long long>(max_key) - min_key + 1);
+
+    if (counting_range_too_large(range, n) || range * num_threads > max_histogram_bytes / sizeof(size_t)) {
+        radix_sort_lsd(arr);
+        return;
+    }
+
+    size_t buckets = static_cast<size_t>(range);
+    std::vector<size_t> count = parallel_histogram(arr, identity, min_key, buckets, num_threads);
+
+    size_t fill_threads = counting_sort_threads(std::max(n, buckets), num_threads);
+    std::vector<size_t> chunk_start(fill_threads + 1, 0);
+    parallel_chunks(buckets, fill_threads, [&](size_t c, size_t begin, size_t end) {
+        size_t total = 0;
+        for (size_t b = begin; b < end; ++b) total += count[b];
+        chunk_start[c + 1] = total;
+    });
+    for (size_t c = 1; c <= fill_threads; ++c) {
+        chunk_start[c] += chunk_start[c - 1];
+    }
+    parallel_chunks(buckets, fill_threads, [&](size_t c, size_t begin, size_t end) {
+        int* out = arr.data() + chunk_start[c];
+        for (size_t b = begin; b < end; ++b) {
+            out = std::fill_n(out, count[b], static_cast<int>(min_key + static_cast<long long>(b)));
+        }
+    });
+}
+
+/**
+ * @brief Compare parallel_counting_sort with the serial sorts
+ */
+void compare_parallel_counting_sort(size_t n = 10000000) {
+    size_t threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    std::cout << "\n=== Parallel Counting Sort (" << n << " keys, " << threads << " threads) ===" << std::endl;
+
+    auto run = [threads](const std::string& name, const std::vector<int>& data) {
+        auto arr1 = data;
+        auto start = std::chrono::high_resolution_clock::now();
+        parallel_counting_sort(arr1, threads);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto time1 = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        auto arr2 = data;
+        start = std::chrono::high_resolution_clock::now();
+        counting_sort_auto_range(arr2);
+        end = std::chrono::high_resolution_clock::now();
+        auto time2 = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        auto arr3 = data;
+        start = std::chrono::high_resolution_clock::now();
+        std::sort(arr3.begin(), arr3.end());
+        end = std::chrono::high_resolution_clock::now();
+        auto time3 = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        std::cout << name << ": parallel " << time1.count() << " ms, counting_sort_auto_range "
+                  << time2.count() << " ms, std::sort " << time3.count() << " ms"
+                  << (arr1 == arr3 && arr2 == arr3 ? "" : " (MISMATCH)") << std::endl;
+    };
+
+    std::vector<int> narrow(n), wide(n);
+    for (size_t i = 0; i < n; ++i) {
+        narrow[i] = rand() % 100000;
+        wide[i] = rand() - RAND_MAX / 2;  // Range far larger than n: radix fallback
+    }
+    run("Range 1e5      ", narrow);
+    run("Range ~2^31    ", wide);
+}
+
+/**
+ * @brief Compare radix sort with std::sort on large inputs
+ */
+void compare_radix_sort(size_t n = 10000000) {
+    std::cout << "\n=== Radix Sort vs std::sort (" << n << " keys) ===" << std::endl;
+
+    auto run = [](const std::string& name, auto data, auto&& radix) {
+        auto arr1 = data;
+        auto start = std::chrono::high_resolution_clock::now();
+        radix(arr1);
+        auto end = std::chrono::high_resolution_clock::now();
+        auto time1 = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        auto arr2 = data;
+        start = std::chrono::high_resolution_clock::now();
+        std::sort(arr2.begin(), arr2.end());
+        end = std::chrono::high_resolution_clock::now();
+        auto time2 = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+        std::cout << name << ": radix " << time1.count() << " ms, std::sort " << time2.count() << " ms"
+                  << (arr1 == arr2 ? "" : " (MISMATCH)") << std::endl;
+    };
+
+    std::vector<uint32_t> u32(n);
+    std::vector<int32_t> i32(n);
+    std::vector<uint64_t> u64(n);
+    std::vector<float> f32(n);
+    std::vector<double> f64(n);
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t r = (static_cast<uint64_t>(rand()) << 32) ^ (static_cast<uint64_t>(rand()) << 16) ^ rand();
+        u32[i] = static_cast<uint32_t>(r);
+        i32[i] = static_cast<int32_t>(r >> 7);
+        u64[i] = r * 0x9E3779B97F4A7C15ULL;
+        f32[i] = static_cast<float>(static_cast<int32_t>(r)) / 1000.0f;
+        f64[i] = static_cast<double>(static_cast<int64_t>(u64[i])) * 1e-9;
+    }
+
+    run("uint32  ", u32, [](auto& a) { radix_sort_lsd<11>(a); });
+    run("int32   ", i32, [](auto& a) { radix_sort_lsd<11>(a); });
+    run("uint64  ", u64, [](auto& a) { radix_sort_lsd<16>(a); });
+    run("float   ", f32, [](auto& a) { radix_sort_lsd<11>(a); });
+    run("double  ", f64, [](auto& a) { radix_sort_lsd<16>(a); });
+
+    std::vector<std::string> strings(n / 10);
+    for (auto& s : strings) {
+        s = "user/" + std::to_string(rand() % 100000) + "/session/" + std::to_string(rand());
+    }
+    run("strings ", strings, [](auto& a) { radix_sort_msd(a); });
+}
+
 /**
  * @brief Test function to demonstrate counting sort variants
  */
@@ -477,7 +1101,7 @@ void test_character_sorting() {
 /**
  * @brief Performance comparison with other sorting algorithms
  */
-void compare_sorting_performance() {
+void compare_counting_sort_performance() {
     // Generate test data with limited range
     std::vector<int> test_data(10000);
     for (int i = 0; i < 10000; ++i) {
@@ -0,0 +1,527 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @brief Selection Algorithms (k-th element, partial sort, streaming top-k)
+ *
+ * Selection answers "which element would be at position k if the array
+ * were sorted?" without paying for the full sort. This file collects the
+ * three flavours used across the sorting chapter:
+ *
+ * - select_nth: in-place introselect, the same contract as std::nth_element.
+ *   Large ranges pick their pivot with Floyd-Rivest sampling, small ranges
+ *   use median-of-three. After a fixed number of passes that keep more than
+ *   three quarters of the range, the pivot comes from median-of-medians,
+ *   which caps the worst case at O(n).
+ * - partial_sort_select: the k smallest elements in sorted order, built on
+ *   select_nth followed by a sort of the k-element prefix.
+ * - TopK: a bounded heap that keeps the k best elements seen so far over an
+ *   input of unknown length. O(n log k) time, O(k) memory.
+ *
+ * Time Complexity:
+ * - select_nth: O(n) average, O(n) worst case
+ * - partial_sort_select: O(n + k log k)
+ * - TopK: O(log k) per push, O(n log k) for a stream of n elements
+ *
+ * Space Complexity:
+ * - select_nth, partial_sort_select: O(log n) recursion for the samples
+ * - TopK: O(k)
+ *
+ * Stable: No
+ *
+ * Applications:
+ * - Medians and percentiles
+ * - Top-k queries over metrics and log streams
+ * - Pivot selection for other algorithms
+ */
+
+namespace select_detail {
+
+// Ranges at or below this size are finished with insertion sort
+constexpr size_t insertion_threshold = 16;
+
+// Floyd-Rivest sampling only pays off on ranges larger than this
+constexpr size_t floyd_rivest_threshold = 600;
+
+// Passes allowed to keep more than 3/4 of the range before switching to
+// median of medians. A constant, so the bad passes cost O(n) in total.
+constexpr int bad_pass_budget = 4;
+
+/**
+ * @brief Insertion sort for the inclusive range [left, right]
+ */
+template <typename T, typename Compare>
+void insertion_sort_range(std::vector<T>& arr, size_t left, size_t right, Compare& comp) {
+    for (size_t i = left + 1; i <= right; ++i) {
+        T value = std::move(arr[i]);
+        size_t j = i;
+        while (j > left && comp(value, arr[j - 1])) {
+            arr[j] = std::move(arr[j - 1]);
+            --j;
+        }
+        arr[j] = std::move(value);
+    }
+}
+
+/**
+ * @brief Index of the median of arr[a], arr[b], arr[c]
+ */
+template <typename T, typename Compare>
+size_t median_of_three(const std::vector<T>& arr, size_t a, size_t b, size_t c, Compare& comp) {
+    if (comp(arr[a], arr[b])) {
+        if (comp(arr[b], arr[c])) return b;
+        return comp(arr[a], arr[c]) ? c : a;
+    }
+    if (comp(arr[a], arr[c])) return a;
+    return comp(arr[b], arr[c]) ? c : b;
+}
+
+/**
+ * @brief Three-way partition of [left, right] around arr[pivot_index]
+ *
+ * Same Dutch national flag scheme as partition_three_way in Quick Sort,
+ * generalized to any comparator. The pivot value always sits at arr[lt]
+ * (the first element of the equal block), so it is never copied.
+ *
+ * Afterwards [left, lt) < pivot, [lt, gt] == pivot and (gt, right] > pivot.
+ * Putting all equal keys in the middle means duplicate-heavy inputs shrink
+ * the range on every pass instead of stalling.
+ */
+template <typename T, typename Compare>
+void partition_three_way_by(std::vector<T>& arr, size_t left, size_t right, size_t pivot_index,
+                            Compare& comp, size_t& lt, size_t& gt) {
+    std::swap(arr[left], arr[pivot_index]);
+    lt = left;
+    gt = right;
+    size_t i = left + 1;
+
+    while (i <= gt) {
+        if (comp(arr[i], arr[lt])) {
+            std::swap(arr[lt], arr[i]);
+            ++lt;
+            ++i;
+        } else if (comp(arr[lt], arr[i])) {
+            std::swap(arr[i], arr[gt]);
+            --gt;
+        } else {
+            ++i;
+        }
+    }
+}
+
+template <typename T, typename Compare>
+void select_range(std::vector<T>& arr, size_t left, size_t right, size_t k,
+                  Compare& comp, int bad_passes_left);
+
+/**
+ * @brief Median-of-medians pivot for [left, right]
+ *
+ * Sorts each group of five, gathers the group medians at the front of the
+ * range and selects their median with no bad passes left, so the
+ * recursion stays on the guaranteed-linear path.
+ *
+ * @return Index of the chosen pivot
+ */
+template <typename T, typename Compare>
+size_t median_of_medians(std::vector<T>& arr, size_t left, size_t right, Compare& comp) {
+    size_t medians = 0;
+    for (size_t group = left; group <= right; group += 5) {
+        size_t group_end = std::min(group + 4, right);
+        insertion_sort_range(arr, group, group_end, comp);
+        std::swap(arr[left + medians], arr[group + (group_end - group) / 2]);
+        ++medians;
+    }
+
+    size_t mid = left + (medians - 1) / 2;
+    select_range(arr, left, left + medians - 1, mid, comp, 0);
+    return mid;
+}
+
+/**
+ * @brief Introselect on the inclusive range [left, right]
+ *
+ * After the call arr[k] holds the element that would be there if the range
+ * were sorted, with nothing greater before it and nothing smaller after it.
+ *
+ * Each pass picks a pivot, partitions three ways and keeps only the side
+ * that contains k:
+ * - bad_passes_left > 0 and a large range: Floyd-Rivest. A sample window
+ *   around k is selected recursively, which leaves arr[k] very close to the
+ *   true k-th element, so the partition throws away almost all of the range
+ * - bad_passes_left > 0 and a small range: median of three
+ * - bad_passes_left == 0: median of medians, guaranteed 30/70 split
+ *
+ * A pass that keeps more than 3/4 of the range uses up one bad pass. Good
+ * passes shrink the range geometrically and there are at most
+ * bad_pass_budget bad ones, so the whole call is O(n) in the worst case.
+ */
+template <typename T, typename Compare>
+void select_range(std::vector<T>& arr, size_t left, size_t right, size_t k,
+                  Compare& comp, int bad_passes_left) {
+    while (right > left) {
+        size_t n = right - left + 1;
+        if (n <= insertion_threshold) {
+            insertion_sort_range(arr, left, right, comp);
+            return;
+        }
+
+        size_t pivot_index;
+        if (bad_passes_left == 0) {
+            pivot_index = median_of_medians(arr, left, right, comp);
+        } else {
+            if (n > floyd_rivest_threshold) {
+                // Sample size s ~ n^(2/3), window offset by sd ~ sqrt(s) towards the middle
+                double z = std::log(static_cast<double>(n));
+                double s = 0.5 * std::exp(2.0 * z / 3.0);
+                double i = static_cast<double>(k - left + 1);
+                double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2.0 ? -1.0 : 1.0);
+                double lo = static_cast<double>(k) - i * s / n + sd;
+                double hi = static_cast<double>(k) + (n - i) * s / n + sd;
+                size_t sample_left = lo > left ? static_cast<size_t>(lo) : left;
+                size_t sample_right = hi < right ? static_cast<size_t>(hi) : right;
+                sample_left = std::min(sample_left, k);
+                sample_right = std::max(sample_right, k);
+                select_range(arr, sample_left, sample_right, k, comp, bad_passes_left);
+                pivot_index = k;
+            } else {
+                pivot_index = median_of_three(arr, left, left + n / 2, right, comp);
+            }
+        }
+
+        size_t lt, gt;
+        partition_three_way_by(arr, left, right, pivot_index, comp, lt, gt);
+
+        if (k < lt) {
+            right = lt - 1;
+        } else if (k > gt) {
+            left = gt + 1;
+        } else {
+            return;
+        }
+
+        if (bad_passes_left > 0 && right - left + 1 > n - n / 4) {
+            --bad_passes_left;
+        }
+    }
+}
+
+/**
+ * @brief Move heap[0] down to its place in a 4-ary heap of size n
+ *
+ * Same hole-based sift as heapify_dary in Heap Sort: comp(a, b) means a
+ * belongs below b, and children are moved up instead of swapped.
+ */
+template <typename T, typename Compare>
+void sift_down_root(std::vector<T>& heap, size_t n, Compare& comp) {
+    T value = std::move(heap[0]);
+    size_t i = 0;
+
+    while (true) {
+        size_t first_child = 4 * i + 1;
+        if (first_child >= n) break;
+
+        size_t last_child = std::min(first_child + 4, n);
+        size_t best = first_child;
+        for (size_t c = first_child + 1; c < last_child; ++c) {
+            if (comp(heap[best], heap[c])) best = c;
+        }
+        if (!comp(value, heap[best])) break;
+
+        heap[i] = std::move(heap[best]);
+        i = best;
+    }
+    heap[i] = std::move(value);
+}
+
+/**
+ * @brief Move heap[i] up to its place in a 4-ary heap
+ */
+template <typename T, typename Compare>
+void sift_up(std::vector<T>& heap, size_t i, Compare& comp) {
+    T value = std::move(heap[i]);
+
+    while (i > 0) {
+        size_t parent = (i - 1) / 4;
+        if (!comp(heap[parent], value)) break;
+        heap[i] = std::move(heap[parent]);
+        i = parent;
+    }
+    heap[i] = std::move(value);
+}
+
+/**
+ * @brief Comparator with its arguments swapped
+ */
+template <typename T, typename Compare>
+struct ReverseCompare {
+    Compare comp;
+    bool operator()(const T& a, const T& b) const { return comp(b, a); }
+};
+
+}  // namespace select_detail
+
+/**
+ * @brief In-place selection of the k-th smallest element (0-based)
+ *
+ * Same contract as std::nth_element: afterwards arr[k] is the element that
+ * a full sort would put there, every element before it is not greater and
+ * every element after it is not smaller. Neither side is sorted.
+ *
+ * @param arr Vector to rearrange
+ * @param k Zero-based rank to select
+ * @param comp Strict weak ordering
+ * @return Reference to arr[k]
+ */
+template <typename T, typename Compare = std::less<T>>
+T& select_nth(std::vector<T>& arr, size_t k, Compare comp = Compare()) {
+    if (k >= arr.size()) {
+        throw std::out_of_range("k is out of bounds");
+    }
+
+    select_detail::select_range(arr, 0, arr.size() - 1, k, comp,
+                                select_detail::bad_pass_budget);
+    return arr[k];
+}
+
+/**
+ * @brief Sort only the k smallest elements into arr[0 .. k)
+ *
+ * Selects position k - 1 first, so the sort afterwards only touches the
+ * k-element prefix. The order of arr[k ..] is unspecified.
+ *
+ * @param arr Vector to partially sort
+ * @param k Number of leading elements to put in sorted order
+ * @param comp Strict weak ordering
+ */
+template <typename T, typename Compare = std::less<T>>
+void partial_sort_select(std::vector<T>& arr, size_t k, Compare comp = Compare()) {
+    k = std::min(k, arr.size());
+    if (k == 0) return;
+
+    select_nth(arr, k - 1, comp);
+    std::sort(arr.begin(), arr.begin() + (k - 1), comp);
+}
+
+/**
+ * @brief Streaming top-k: keeps the k greatest elements seen so far
+ *
+ * The elements live in a 4-ary heap ordered with the weakest kept element
+ * at the root. A new element only has to beat that root to get in, so
+ * most pushes on a long stream cost a single comparison and memory never
+ * grows beyond k elements.
+ *
+ * "Greatest" follows comp: the default std::less keeps the k largest,
+ * std::greater keeps the k smallest. Among equivalent elements the ones
+ * that arrived first are kept.
+ */
+template <typename T, typename Compare = std::less<T>>
+class TopK {
+private:
+    std::vector<T> heap;
+    size_t limit;
+    Compare comp;
+    select_detail::ReverseCompare<T, Compare> heap_comp;
+
+public:
+    /**
+     * @brief Create an empty top-k collector
+     * @param k Number of elements to keep
+     * @param compare Strict weak ordering
+     */
+    explicit TopK(size_t k, Compare compare = Compare())
+        : limit(k), comp(compare), heap_comp{compare} {
+        heap.reserve(k);
+    }
+
+    /**
+     * @brief Offer an element to the collector
+     * @return true if the element is now among the kept ones
+     */
+    template <typename U>
+    bool push(U&& value) {
+        if (heap.size() < limit) {
+            heap.emplace_back(std::forward<U>(value));
+            select_detail::sift_up(heap, heap.size() - 1, heap_comp);
+            return true;
+        }
+        if (limit == 0 || !comp(heap[0], value)) {
+            return false;
+        }
+
+        heap[0] = std::forward<U>(value);
+        select_detail::sift_down_root(heap, heap.size(), heap_comp);
+        return true;
+    }
+
+    /**
+     * @brief Offer every element of [first, last)
+     */
+    template <typename Iterator>
+    void push_range(Iterator first, Iterator last) {
+        for (; first != last; ++first) {
+            push(*first);
+        }
+    }
+
+    /**
+     * @brief Fold another collector into this one (e.g. per-shard results)
+     */
+    void merge(const TopK& other) {
+        push_range(other.heap.begin(), other.heap.end());
+    }
+
+    /**
+     * @brief Weakest kept element, the bar a new element has to clear
+     */
+    const T& threshold() const {
+        if (heap.empty()) {
+            throw std::out_of_range("TopK is empty");
+        }
+        return heap[0];
+    }
+
+    /**
+     * @brief Kept elements, best first
+     */
+    std::vector<T> sorted() const {
+        std::vector<T> result = heap;
+        std::sort(result.begin(), result.end(), heap_comp);
+        return result;
+    }
+
+    /**
+     * @brief Move the kept elements out, best first, and reset the collector
+     */
+    std::vector<T> take_sorted() {
+        std::vector<T> result = std::move(heap);
+        heap.clear();
+        heap.reserve(limit);
+        std::sort(result.begin(), result.end(), heap_comp);
+        return result;
+    }
+
+    /**
+     * @brief Kept elements in heap order (no sorting cost)
+     */
+    const std::vector<T>& unordered() const { return heap; }
+
+    size_t size() const { return heap.size(); }
+    size_t capacity() const { return limit; }
+    bool empty() const { return heap.empty(); }
+    bool full() const { return heap.size() == limit; }
+    void clear() { heap.clear(); }
+};
+
+/**
+ * @brief The k greatest elements of data, best first
+ * @param data Input elements (not modified)
+ * @param k Number of elements to return
+ * @param comp Strict weak ordering (std::greater for the k smallest)
+ */
+template <typename T, typename Compare = std::less<T>>
+std::vector<T> top_k(const std::vector<T>& data, size_t k, Compare comp = Compare()) {
+    TopK<T, Compare> collector(k, comp);
+    collector.push_range(data.begin(), data.end());
+    return collector.take_sorted();
+}
+
+/**
+ * @brief Test function to demonstrate the selection algorithms
+ */
+void test_selection() {
+    std::vector<int> arr = {7, 10, 4, 3, 20, 15, 4, 8};
+    print_array(arr, "Original array");
+
+    for (size_t k = 0; k < arr.size(); ++k) {
+        auto copy = arr;
+        std::cout << "select_nth(" << k << ") = " << select_nth(copy, k) << std::endl;
+    }
+
+    auto partial = arr;
+    partial_sort_select(partial, 3);
+    print_array(partial, "partial_sort_select (k = 3)");
+
+    TopK<int> largest(3);
+    TopK<int, std::greater<int>> smallest(3);
+    for (int value : arr) {
+        largest.push(value);
+        smallest.push(value);
+    }
+    print_array(largest.sorted(), "TopK largest 3");
+    print_array(smallest.sorted(), "TopK smallest 3");
+}
+
+/**
+ * @brief Compare selection against full sorting and the standard library
+ * @param n Number of elements
+ */
+void compare_selection(size_t n = 1000000) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> dist(0, 1 << 30);
+
+    std::vector<int> random_data(n);
+    for (auto& x : random_data) x = dist(rng);
+
+    // Median-of-three killer for naive quickselect: sorted with duplicates
+    std::vector<int> sorted_data(n);
+    for (size_t i = 0; i < n; ++i) sorted_data[i] = static_cast<int>(i / 4);
+
+    auto time_us = [](auto&& fn) {
+        auto start = std::chrono::high_resolution_clock::now();
+        fn();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    };
+
+    std::cout << "\n=== Selection Performance (" << n << " elements) ===" << std::endl;
+
+    const std::vector<int>* inputs[] = {&random_data, &sorted_data};
+    const char* names[] = {"random", "sorted"};
+    for (int d = 0; d < 2; ++d) {
+        const auto& data = *inputs[d];
+        size_t median = n / 2;
+        int expected = 0, got = 0;
+
+        auto a = data;
+        auto t_sort = time_us([&] { std::sort(a.begin(), a.end()); expected = a[median]; });
+        auto b = data;
+        auto t_std = time_us([&] { std::nth_element(b.begin(), b.begin() + median, b.end()); });
+        auto c = data;
+        auto t_select = time_us([&] { got = select_nth(c, median); });
+
+        std::cout << names[d] << " median: sort " << t_sort << " μs, std::nth_element "
+                  << t_std << " μs, select_nth " << t_select << " μs"
+                  << (got == expected ? "" : "  MISMATCH") << std::endl;
+    }
+
+    const size_t k = 100;
+    std::vector<int> expected_top(random_data);
+    std::sort(expected_top.begin(), expected_top.end(), std::greater<int>());
+    expected_top.resize(k);
+
+    std::vector<int> result;
+    auto t_topk = time_us([&] { result = top_k(random_data, k); });
+    bool topk_ok = result == expected_top;
+
+    auto p = random_data;
+    auto t_partial = time_us([&] { partial_sort_select(p, k, std::greater<int>()); });
+    bool partial_ok = std::equal(expected_top.begin(), expected_top.end(), p.begin());
+
+    auto q = random_data;
+    auto t_std_partial = time_us([&] {
+        std::partial_sort(q.begin(), q.begin() + k, q.end(), std::greater<int>());
+    });
+
+    std::cout << "top " << k << ": TopK " << t_topk << " μs" << (topk_ok ? "" : "  MISMATCH")
+              << ", partial_sort_select " << t_partial << " μs" << (partial_ok ? "" : "  MISMATCH")
+              << ", std::partial_sort " << t_std_partial << " μs" << std::endl;
+}
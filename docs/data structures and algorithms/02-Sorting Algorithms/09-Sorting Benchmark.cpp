@@ -0,0 +1,898 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define SORT_BENCHMARK_HAVE_PERF_EVENT
+#endif
+
+#include "01-Bubble Sort.cpp"
+#include "02-Selection Sort.cpp"
+#include "03-Insertion Sort.cpp"
+#include "04-Merge Sort.cpp"
+#include "05-Quick Sort.cpp"
+#include "06-Heap Sort.cpp"
+#include "07-Counting Sort.cpp"
+#include "08-Selection.cpp"
+#include "10-Sorting Networks.cpp"
+
+/**
+ * @brief Sorting Benchmark Suite
+ *
+ * One harness for every sort in this directory, so numbers from different
+ * files can be compared and diffed between runs. Each registered variant is
+ * run over the same inputs:
+ *
+ * - Distributions: random, sorted, reversed, few-unique (16 keys),
+ *   organ-pipe (0 1 2 .. n/2 .. 2 1 0) and nearly sorted (1% random swaps)
+ * - Element types: 32-bit ints and 64-byte records sorted by an int key
+ * - Sizes: 1e2 .. 1e8 by default
+ *
+ * For every (variant, element, distribution, n) it reports:
+ * - best and mean wall time over enough repetitions to fill min_time_ms
+ * - comparisons and moves, from a separate pass over an instrumented
+ *   element type (generic sorts only; int-only sorts leave them empty)
+ * - cycles, instructions, cache misses and branch misses from perf_event
+ *   on Linux, averaged per repetition (left empty where unavailable)
+ * - whether the output matched std::sort
+ *
+ * Results are written as CSV or JSON, one row per measurement.
+ *
+ * Quadratic sorts only run up to quadratic_limit elements. The textbook
+ * quick sorts (Lomuto/Hoare with fixed pivots) are quadratic on anything
+ * but random input, so they get the same limit on structured inputs.
+ * Inputs that would need more than max_memory_bytes are skipped.
+ *
+ * Build the standalone target with:
+ *   g++ -std=c++17 -O2 -pthread -DSORTING_BENCHMARK_MAIN -o sort_bench "09-Sorting Benchmark.cpp"
+ *   ./sort_bench --sizes=1000,1000000 --dist=random,sorted --format=json --out=run.json
+ */
+
+/**
+ * @brief Input distributions used by the benchmark
+ */
+enum class SortDistribution {
+    Random,
+    Sorted,
+    Reversed,
+    FewUnique,
+    OrganPipe,
+    NearlySorted
+};
+
+const char* sort_distribution_name(SortDistribution distribution) {
+    switch (distribution) {
+        case SortDistribution::Random: return "random";
+        case SortDistribution::Sorted: return "sorted";
+        case SortDistribution::Reversed: return "reversed";
+        case SortDistribution::FewUnique: return "few_unique";
+        case SortDistribution::OrganPipe: return "organ_pipe";
+        case SortDistribution::NearlySorted: return "nearly_sorted";
+    }
+    return "unknown";
+}
+
+std::vector<SortDistribution> all_sort_distributions() {
+    return {SortDistribution::Random, SortDistribution::Sorted, SortDistribution::Reversed,
+            SortDistribution::FewUnique, SortDistribution::OrganPipe, SortDistribution::NearlySorted};
+}
+
+SortDistribution parse_sort_distribution(const std::string& name) {
+    for (SortDistribution distribution : all_sort_distributions()) {
+        if (name == sort_distribution_name(distribution)) {
+            return distribution;
+        }
+    }
+    throw std::invalid_argument("Unknown distribution: " + name);
+}
+
+/**
+ * @brief Generate n non-negative keys with the given distribution
+ *
+ * Keys stay in [0, INT_MAX] so the counting sorts that assume
+ * non-negative input can run on every distribution.
+ */
+std::vector<int> generate_sort_input(SortDistribution distribution, size_t n, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> data(n);
+
+    switch (distribution) {
+        case SortDistribution::Random: {
+            std::uniform_int_distribution<int> dist(0, std::numeric_limits<int>::max());
+            for (auto& x : data) x = dist(rng);
+            break;
+        }
+        case SortDistribution::Sorted:
+            for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i);
+            break;
+        case SortDistribution::Reversed:
+            for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(n - 1 - i);
+            break;
+        case SortDistribution::FewUnique: {
+            std::uniform_int_distribution<int> dist(0, 15);
+            for (auto& x : data) x = dist(rng) * 1000003;
+            break;
+        }
+        case SortDistribution::OrganPipe:
+            for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(std::min(i, n - 1 - i));
+            break;
+        case SortDistribution::NearlySorted: {
+            for (size_t i = 0; i < n; ++i) data[i] = static_cast<int>(i);
+            if (n > 1) {
+                std::uniform_int_distribution<size_t> pos(0, n - 1);
+                for (size_t s = 0, swaps = std::max<size_t>(1, n / 100); s < swaps; ++s) {
+                    std::swap(data[pos(rng)], data[pos(rng)]);
+                }
+            }
+            break;
+        }
+    }
+    return data;
+}
+
+/**
+ * @brief 64-byte record sorted by its key (one cache line per element)
+ */
+struct BenchmarkRecord {
+    int32_t key;
+    uint32_t payload[15];
+
+    BenchmarkRecord() : key(0), payload{} {}
+    explicit BenchmarkRecord(int k) : key(k) {
+        for (uint32_t i = 0; i < 15; ++i) payload[i] = static_cast<uint32_t>(k) ^ i;
+    }
+
+    bool operator<(const BenchmarkRecord& other) const { return key < other.key; }
+    bool operator>(const BenchmarkRecord& other) const { return key > other.key; }
+    bool operator<=(const BenchmarkRecord& other) const { return key <= other.key; }
+    bool operator>=(const BenchmarkRecord& other) const { return key >= other.key; }
+};
+
+static_assert(sizeof(BenchmarkRecord) == 64, "BenchmarkRecord should fill one cache line");
+
+/**
+ * @brief Global comparison and move counters for CountedInt
+ *
+ * Atomic so the parallel sorts can be counted too; the counting pass is
+ * separate from the timed runs, so the cost doesn't show up in the times.
+ */
+struct SortOperationCounts {
+    std::atomic<uint64_t> comparisons{0};
+    std::atomic<uint64_t> moves{0};
+
+    void reset() {
+        comparisons.store(0, std::memory_order_relaxed);
+        moves.store(0, std::memory_order_relaxed);
+    }
+};
+
+SortOperationCounts& sort_operation_counts() {
+    static SortOperationCounts counts;
+    return counts;
+}
+
+/**
+ * @brief int wrapper that counts every comparison and every copy/move
+ *
+ * A swap shows up as three moves, the same way it costs three writes.
+ */
+struct CountedInt {
+    int value;
+
+    CountedInt() : value(0) {}
+    explicit CountedInt(int v) : value(v) {}
+
+    CountedInt(const CountedInt& other) : value(other.value) { count_move(); }
+    CountedInt(CountedInt&& other) noexcept : value(other.value) { count_move(); }
+    CountedInt& operator=(const CountedInt& other) {
+        value = other.value;
+        count_move();
+        return *this;
+    }
+    CountedInt& operator=(CountedInt&& other) noexcept {
+        value = other.value;
+        count_move();
+        return *this;
+    }
+
+    static void count_move() {
+        sort_operation_counts().moves.fetch_add(1, std::memory_order_relaxed);
+    }
+    static bool counted(bool result) {
+        sort_operation_counts().comparisons.fetch_add(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    bool operator<(const CountedInt& other) const { return counted(value < other.value); }
+    bool operator>(const CountedInt& other) const { return counted(value > other.value); }
+    bool operator<=(const CountedInt& other) const { return counted(value <= other.value); }
+    bool operator>=(const CountedInt& other) const { return counted(value >= other.value); }
+    bool operator==(const CountedInt& other) const { return counted(value == other.value); }
+    bool operator!=(const CountedInt& other) const { return counted(value != other.value); }
+};
+
+inline int benchmark_sort_key(int value) { return value; }
+inline int benchmark_sort_key(const BenchmarkRecord& record) { return record.key; }
+inline int benchmark_sort_key(const CountedInt& value) { return value.value; }
+
+/**
+ * @brief One sample of hardware counters (-1 = counter not available)
+ */
+struct PerfSample {
+    int64_t cycles = -1;
+    int64_t instructions = -1;
+    int64_t cache_misses = -1;
+    int64_t branch_misses = -1;
+};
+
+/**
+ * @brief Cycles, instructions, cache misses and branch misses for this thread
+ *
+ * Opens the four hardware events as one perf_event group so they are
+ * enabled, disabled and read together. Events the kernel or the
+ * perf_event_paranoid setting refuses stay at -1; if the group leader
+ * can't be opened nothing is measured and the benchmark only reports times.
+ * Only the calling thread is measured, so the parallel sorts undercount.
+ */
+class PerfCounterGroup {
+private:
+    static constexpr int num_events = 4;
+    int fds[num_events] = {-1, -1, -1, -1};
+    int slot[num_events] = {-1, -1, -1, -1};  // position in the group read
+    int opened = 0;
+
+#if defined(SORT_BENCHMARK_HAVE_PERF_EVENT)
+    static int open_event(uint64_t config, int group_fd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+#endif
+
+public:
+    PerfCounterGroup() {
+#if defined(SORT_BENCHMARK_HAVE_PERF_EVENT)
+        const uint64_t configs[num_events] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                              PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+        for (int e = 0; e < num_events; ++e) {
+            int fd = open_event(configs[e], fds[0]);
+            if (fd < 0) {
+                if (e == 0) return;  // no leader, no group
+                continue;
+            }
+            fds[e] = fd;
+            slot[e] = opened++;
+        }
+#endif
+    }
+
+    ~PerfCounterGroup() {
+#if defined(SORT_BENCHMARK_HAVE_PERF_EVENT)
+        for (int fd : fds) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    bool available() const { return opened > 0; }
+
+    void start() {
+#if defined(SORT_BENCHMARK_HAVE_PERF_EVENT)
+        if (!available()) return;
+        ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerfSample stop() {
+        PerfSample sample;
+#if defined(SORT_BENCHMARK_HAVE_PERF_EVENT)
+        if (!available()) return sample;
+        ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        uint64_t buffer[1 + num_events] = {};
+        if (read(fds[0], buffer, sizeof(buffer)) <= 0) return sample;
+
+        int64_t* fields[num_events] = {&sample.cycles, &sample.instructions,
+                                       &sample.cache_misses, &sample.branch_misses};
+        for (int e = 0; e < num_events; ++e) {
+            if (slot[e] >= 0 && static_cast<uint64_t>(slot[e]) < buffer[0]) {
+                *fields[e] = static_cast<int64_t>(buffer[1 + slot[e]]);
+            }
+        }
+#endif
+        return sample;
+    }
+};
+
+/**
+ * @brief How a variant scales, used to keep runs finite
+ */
+enum class SortComplexity {
+    Linearithmic,           // O(n log n) or better on every distribution
+    QuadraticOnStructured,  // O(n log n) on random input, O(n²) on the rest
+    Quadratic               // O(n²) on every distribution
+};
+
+/**
+ * @brief A registered sort: one entry per element type it supports
+ *
+ * sort_records and sort_counted are empty for int-only sorts.
+ */
+struct SortVariant {
+    std::string name;
+    std::string family;
+    SortComplexity complexity;
+    std::function<void(std::vector<int>&)> sort_ints;
+    std::function<void(std::vector<BenchmarkRecord>&)> sort_records;
+    std::function<void(std::vector<CountedInt>&)> sort_counted;
+};
+
+/**
+ * @brief Register a sort that only works on std::vector<int>
+ */
+SortVariant int_sort_variant(const std::string& name, const std::string& family,
+                             SortComplexity complexity, std::function<void(std::vector<int>&)> fn) {
+    return SortVariant{name, family, complexity, std::move(fn), nullptr, nullptr};
+}
+
+/**
+ * @brief Register a generic sort for ints, records and counted ints at once
+ * @param fn Generic callable taking any std::vector<T>&
+ */
+template <typename Fn>
+SortVariant generic_sort_variant(const std::string& name, const std::string& family,
+                                 SortComplexity complexity, Fn fn) {
+    return SortVariant{name, family, complexity,
+                       [fn](std::vector<int>& v) { fn(v); },
+                       [fn](std::vector<BenchmarkRecord>& v) { fn(v); },
+                       [fn](std::vector<CountedInt>& v) { fn(v); }};
+}
+
+/**
+ * @brief Every sort in this directory that produces ascending output
+ *
+ * Left out: heap_sort_min_heap and counting_sort_descending (descending
+ * output), the counting sorts that need max_val or a key type other than
+ * int, and the partial/selection helpers.
+ */
+std::vector<SortVariant> sorting_benchmark_variants() {
+    using C = SortComplexity;
+    auto last = [](const std::vector<int>& v) { return static_cast<int>(v.size()) - 1; };
+    std::vector<SortVariant> variants;
+
+    // Baselines
+    variants.push_back(generic_sort_variant("std::sort", "std", C::Linearithmic,
+        [](auto& v) { std::sort(v.begin(), v.end()); }));
+    variants.push_back(generic_sort_variant("std::stable_sort", "std", C::Linearithmic,
+        [](auto& v) { std::stable_sort(v.begin(), v.end()); }));
+
+    // 01-Bubble Sort
+    variants.push_back(int_sort_variant("bubble_sort_basic", "bubble", C::Quadratic,
+        [](std::vector<int>& v) { bubble_sort_basic(v); }));
+    variants.push_back(int_sort_variant("bubble_sort_optimized", "bubble", C::Quadratic,
+        [](std::vector<int>& v) { bubble_sort_optimized(v); }));
+    variants.push_back(int_sort_variant("bubble_sort_boundary_optimized", "bubble", C::Quadratic,
+        [](std::vector<int>& v) { bubble_sort_boundary_optimized(v); }));
+    variants.push_back(int_sort_variant("bubble_sort_recursive", "bubble", C::Quadratic,
+        [](std::vector<int>& v) { bubble_sort_recursive(v, static_cast<int>(v.size())); }));
+    variants.push_back(generic_sort_variant("bubble_sort_generic", "bubble", C::Quadratic,
+        [](auto& v) { bubble_sort_generic(v); }));
+    variants.push_back(int_sort_variant("cocktail_shaker_sort", "bubble", C::Quadratic,
+        [](std::vector<int>& v) { cocktail_shaker_sort(v); }));
+
+    // 02-Selection Sort
+    variants.push_back(int_sort_variant("selection_sort_basic", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_basic(v); }));
+    variants.push_back(int_sort_variant("selection_sort_max_approach", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_max_approach(v); }));
+    variants.push_back(int_sort_variant("selection_sort_bidirectional", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_bidirectional(v); }));
+    variants.push_back(int_sort_variant("selection_sort_stable", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_stable(v); }));
+    variants.push_back(generic_sort_variant("selection_sort_generic", "selection", C::Quadratic,
+        [](auto& v) { selection_sort_generic(v); }));
+    variants.push_back(int_sort_variant("selection_sort_optimized", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_optimized(v); }));
+    variants.push_back(int_sort_variant("selection_sort_recursive", "selection", C::Quadratic,
+        [](std::vector<int>& v) { selection_sort_recursive(v, 0, static_cast<int>(v.size())); }));
+
+    // 03-Insertion Sort
+    variants.push_back(int_sort_variant("insertion_sort_basic", "insertion", C::Quadratic,
+        [](std::vector<int>& v) { insertion_sort_basic(v); }));
+    variants.push_back(int_sort_variant("insertion_sort_binary", "insertion", C::Quadratic,
+        [](std::vector<int>& v) { insertion_sort_binary(v); }));
+    variants.push_back(int_sort_variant("insertion_sort_recursive", "insertion", C::Quadratic,
+        [](std::vector<int>& v) { insertion_sort_recursive(v, static_cast<int>(v.size())); }));
+    variants.push_back(generic_sort_variant("insertion_sort_generic", "insertion", C::Quadratic,
+        [](auto& v) { insertion_sort_generic(v); }));
+    variants.push_back(int_sort_variant("insertion_sort_sentinel", "insertion", C::Quadratic,
+        [](std::vector<int>& v) { insertion_sort_sentinel(v); }));
+    variants.push_back(int_sort_variant("insertion_sort_optimized", "insertion", C::Quadratic,
+        [](std::vector<int>& v) { insertion_sort_optimized(v); }));
+    variants.push_back(int_sort_variant("shell_sort", "insertion", C::Linearithmic,
+        [](std::vector<int>& v) { shell_sort(v); }));
+
+    // 04-Merge Sort
+    variants.push_back(int_sort_variant("merge_sort", "merge", C::Linearithmic,
+        [](std::vector<int>& v) { merge_sort(v); }));
+    variants.push_back(int_sort_variant("merge_sort_iterative", "merge", C::Linearithmic,
+        [](std::vector<int>& v) { merge_sort_iterative(v); }));
+    variants.push_back(int_sort_variant("merge_sort_inplace", "merge", C::Quadratic,
+        [last](std::vector<int>& v) { if (!v.empty()) merge_sort_inplace(v, 0, last(v)); }));
+    variants.push_back(generic_sort_variant("merge_sort_custom", "merge", C::Linearithmic,
+        [](auto& v) {
+            using T = typename std::decay_t<decltype(v)>::value_type;
+            merge_sort_custom(v, std::less<T>());
+        }));
+    variants.push_back(generic_sort_variant("merge_sort_adaptive", "merge", C::Linearithmic,
+        [](auto& v) { merge_sort_adaptive(v); }));
+    variants.push_back(generic_sort_variant("parallel_merge_sort", "merge", C::Linearithmic,
+        [](auto& v) { parallel_merge_sort(v); }));
+    variants.push_back(int_sort_variant("merge_sort_hybrid", "merge", C::Linearithmic,
+        [](std::vector<int>& v) { merge_sort_hybrid(v); }));
+
+    // 05-Quick Sort
+    variants.push_back(int_sort_variant("quick_sort_lomuto", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_lomuto(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_hoare", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_hoare(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_median_of_three", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_median_of_three(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_iterative", "quick", C::QuadraticOnStructured,
+        [](std::vector<int>& v) { quick_sort_iterative(v); }));
+    variants.push_back(int_sort_variant("quick_sort_random_pivot", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_random_pivot(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_three_way", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_three_way(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_tail_optimized", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_tail_optimized(v, 0, last(v)); }));
+    variants.push_back(int_sort_variant("quick_sort_hybrid", "quick", C::QuadraticOnStructured,
+        [last](std::vector<int>& v) { if (!v.empty()) quick_sort_hybrid(v, 0, last(v)); }));
+    variants.push_back(generic_sort_variant("quick_sort_custom", "quick", C::QuadraticOnStructured,
+        [](auto& v) {
+            using T = typename std::decay_t<decltype(v)>::value_type;
+            if (!v.empty()) quick_sort_custom(v, 0, static_cast<int>(v.size()) - 1, std::less<T>());
+        }));
+    variants.push_back(int_sort_variant("quick_sort_pdq", "quick", C::Linearithmic,
+        [](std::vector<int>& v) { quick_sort_pdq(v); }));
+
+    // 06-Heap Sort
+    variants.push_back(int_sort_variant("heap_sort_basic", "heap", C::Linearithmic,
+        [](std::vector<int>& v) { heap_sort_basic(v); }));
+    variants.push_back(int_sort_variant("heap_sort_iterative", "heap", C::Linearithmic,
+        [](std::vector<int>& v) { heap_sort_iterative(v); }));
+    variants.push_back(int_sort_variant("heap_sort_optimized", "heap", C::Linearithmic,
+        [](std::vector<int>& v) { heap_sort_optimized(v); }));
+    variants.push_back(generic_sort_variant("heap_sort_generic", "heap", C::Linearithmic,
+        [](auto& v) { heap_sort_generic(v); }));
+    variants.push_back(int_sort_variant("heap_sort_range", "heap", C::Linearithmic,
+        [last](std::vector<int>& v) { if (!v.empty()) heap_sort_range(v, 0, last(v)); }));
+
+    // 07-Counting Sort
+    variants.push_back(int_sort_variant("counting_sort_auto_range", "counting", C::Linearithmic,
+        [](std::vector<int>& v) { counting_sort_auto_range(v); }));
+    variants.push_back(int_sort_variant("parallel_counting_sort", "counting", C::Linearithmic,
+        [](std::vector<int>& v) { parallel_counting_sort(v); }));
+    variants.push_back(SortVariant{"radix_sort_lsd", "counting", C::Linearithmic,
+        [](std::vector<int>& v) { radix_sort_lsd(v); },
+        [](std::vector<BenchmarkRecord>& v) {
+            radix_sort_lsd_by(v, [](const BenchmarkRecord& r) { return r.key; });
+        },
+        nullptr});
+    variants.push_back(SortVariant{"parallel_counting_sort_by", "counting", C::Linearithmic,
+        nullptr,
+        [](std::vector<BenchmarkRecord>& v) {
+            parallel_counting_sort_by(v, [](const BenchmarkRecord& r) { return r.key; });
+        },
+        nullptr});
+
+    // 08-Selection
+    variants.push_back(generic_sort_variant("partial_sort_select", "selection_algorithms", C::Linearithmic,
+        [](auto& v) { partial_sort_select(v, v.size()); }));
+
+    return variants;
+}
+
+/**
+ * @brief Benchmark settings; the defaults run the full matrix
+ */
+struct SortBenchmarkConfig {
+    std::vector<size_t> sizes = {100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+    std::vector<SortDistribution> distributions = all_sort_distributions();
+    bool records = true;               // also benchmark 64-byte records
+    bool count_operations = true;      // run the CountedInt pass
+    std::string filter;                // substring of name or family, empty = all
+    std::string format = "csv";        // "csv" or "json"
+    std::string output;                // file path, empty = stdout
+    double min_time_ms = 200.0;        // keep repeating until this much time is measured
+    size_t max_repetitions = 1000;
+    size_t quadratic_limit = 20000;    // largest n for O(n²) runs
+    size_t count_limit = 1000000;      // largest n for the counting pass
+    size_t max_memory_bytes = size_t(4) << 30;
+    uint32_t seed = 42;
+};
+
+/**
+ * @brief One row of benchmark output
+ */
+struct SortBenchmarkResult {
+    std::string algorithm;
+    std::string family;
+    std::string element;
+    std::string distribution;
+    size_t n = 0;
+    size_t repetitions = 0;
+    double best_ms = 0.0;
+    double mean_ms = 0.0;
+    int64_t comparisons = -1;
+    int64_t moves = -1;
+    PerfSample perf;
+    bool correct = false;
+
+    double ns_per_element() const {
+        return n == 0 ? 0.0 : best_ms * 1e6 / static_cast<double>(n);
+    }
+};
+
+/**
+ * @brief Streams results as CSV rows or a JSON array
+ *
+ * Rows are flushed as they are produced, so a long run can be watched
+ * (and a killed run still leaves usable data behind).
+ */
+class SortBenchmarkReporter {
+private:
+    std::ostream& out;
+    bool json;
+    bool first_row = true;
+
+    static void csv_value(std::ostream& os, int64_t value) {
+        if (value >= 0) os << value;
+    }
+    static void json_value(std::ostream& os, int64_t value) {
+        if (value >= 0) {
+            os << value;
+        } else {
+            os << "null";
+        }
+    }
+
+public:
+    SortBenchmarkReporter(std::ostream& os, const std::string& format) : out(os), json(format == "json") {
+        if (format != "csv" && format != "json") {
+            throw std::invalid_argument("Unknown output format: " + format);
+        }
+    }
+
+    void begin() {
+        if (json) {
+            out << "[";
+        } else {
+            out << "algorithm,family,element,distribution,n,repetitions,best_ms,mean_ms,ns_per_element,"
+                   "comparisons,moves,cycles,instructions,cache_misses,branch_misses,correct\n";
+        }
+        out.flush();
+    }
+
+    void add(const SortBenchmarkResult& r) {
+        out << std::setprecision(6);
+        if (json) {
+            out << (first_row ? "\n" : ",\n")
+                << "  {\"algorithm\": \"" << r.algorithm << "\", \"family\": \"" << r.family
+                << "\", \"element\": \"" << r.element << "\", \"distribution\": \"" << r.distribution
+                << "\", \"n\": " << r.n << ", \"repetitions\": " << r.repetitions
+                << ", \"best_ms\": " << r.best_ms << ", \"mean_ms\": " << r.mean_ms
+                << ", \"ns_per_element\": " << r.ns_per_element() << ", \"comparisons\": ";
+            json_value(out, r.comparisons);
+            out << ", \"moves\": ";
+            json_value(out, r.moves);
+            out << ", \"cycles\": ";
+            json_value(out, r.perf.cycles);
+            out << ", \"instructions\": ";
+            json_value(out, r.perf.instructions);
+            out << ", \"cache_misses\": ";
+            json_value(out, r.perf.cache_misses);
+            out << ", \"branch_misses\": ";
+            json_value(out, r.perf.branch_misses);
+            out << ", \"correct\": " << (r.correct ? "true" : "false") << "}";
+        } else {
+            out << r.algorithm << ',' << r.family << ',' << r.element << ',' << r.distribution << ','
+                << r.n << ',' << r.repetitions << ',' << r.best_ms << ',' << r.mean_ms << ','
+                << r.ns_per_element() << ',';
+            csv_value(out, r.comparisons);
+            out << ',';
+            csv_value(out, r.moves);
+            out << ',';
+            csv_value(out, r.perf.cycles);
+            out << ',';
+            csv_value(out, r.perf.instructions);
+            out << ',';
+            csv_value(out, r.perf.cache_misses);
+            out << ',';
+            csv_value(out, r.perf.branch_misses);
+            out << ',' << (r.correct ? "true" : "false") << '\n';
+        }
+        first_row = false;
+        out.flush();
+    }
+
+    void end() {
+        if (json) {
+            out << "\n]\n";
+        }
+        out.flush();
+    }
+};
+
+/**
+ * @brief Time one sort on one input
+ *
+ * Every repetition sorts a fresh copy of the input; the copy is not timed.
+ * The first repetition's output is checked against the std::sort result
+ * by key, since unstable sorts may reorder equal-keyed records.
+ */
+template <typename T>
+void measure_sort(const std::vector<T>& input, const std::vector<int>& expected_keys,
+                  const std::function<void(std::vector<T>&)>& sort_fn,
+                  const SortBenchmarkConfig& config, PerfCounterGroup& perf,
+                  SortBenchmarkResult& result) {
+    double total_ms = 0.0;
+    double best_ms = std::numeric_limits<double>::max();
+    PerfSample total;
+    bool have_perf = false;
+    size_t reps = 0;
+
+    while (reps < std::max<size_t>(1, config.max_repetitions) &&
+           (reps == 0 || total_ms < config.min_time_ms)) {
+        std::vector<T> data = input;
+
+        perf.start();
+        auto start = std::chrono::high_resolution_clock::now();
+        sort_fn(data);
+        auto end = std::chrono::high_resolution_clock::now();
+        PerfSample sample = perf.stop();
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        total_ms += ms;
+        best_ms = std::min(best_ms, ms);
+
+        if (sample.cycles >= 0) {
+            if (!have_perf) {
+                total = PerfSample{0, 0, 0, 0};
+                have_perf = true;
+            }
+            total.cycles += sample.cycles;
+            total.instructions += std::max<int64_t>(0, sample.instructions);
+            total.cache_misses += std::max<int64_t>(0, sample.cache_misses);
+            total.branch_misses += std::max<int64_t>(0, sample.branch_misses);
+        }
+
+        if (reps == 0) {
+            result.correct = data.size() == expected_keys.size() &&
+                             std::equal(data.begin(), data.end(), expected_keys.begin(),
+                                        [](const T& a, int key) { return benchmark_sort_key(a) == key; });
+        }
+        ++reps;
+    }
+
+    result.repetitions = reps;
+    result.best_ms = best_ms;
+    result.mean_ms = total_ms / reps;
+    if (have_perf) {
+        int64_t r = static_cast<int64_t>(reps);
+        result.perf.cycles = total.cycles / r;
+        result.perf.instructions = total.instructions / r;
+        result.perf.cache_misses = total.cache_misses / r;
+        result.perf.branch_misses = total.branch_misses / r;
+    }
+}
+
+/**
+ * @brief Comparisons and moves for one sort, using CountedInt
+ */
+void count_sort_operations(const std::vector<int>& input,
+                           const std::function<void(std::vector<CountedInt>&)>& sort_fn,
+                           SortBenchmarkResult& result) {
+    std::vector<CountedInt> data(input.begin(), input.end());
+    sort_operation_counts().reset();
+    sort_fn(data);
+    result.comparisons = static_cast<int64_t>(sort_operation_counts().comparisons.load());
+    result.moves = static_cast<int64_t>(sort_operation_counts().moves.load());
+}
+
+/**
+ * @brief Whether a variant should run at this size and distribution
+ */
+bool sort_variant_runs(const SortVariant& variant, SortDistribution distribution,
+                       size_t n, const SortBenchmarkConfig& config) {
+    if (!config.filter.empty() && variant.name.find(config.filter) == std::string::npos &&
+        variant.family.find(config.filter) == std::string::npos) {
+        return false;
+    }
+    switch (variant.complexity) {
+        case SortComplexity::Quadratic:
+            return n <= config.quadratic_limit;
+        case SortComplexity::QuadraticOnStructured:
+            return distribution == SortDistribution::Random || n <= config.quadratic_limit;
+        case SortComplexity::Linearithmic:
+            return true;
+    }
+    return true;
+}
+
+/**
+ * @brief Run the benchmark matrix and write the results
+ */
+void run_sorting_benchmarks(const SortBenchmarkConfig& config = SortBenchmarkConfig()) {
+    std::ofstream file;
+    if (!config.output.empty()) {
+        file.open(config.output);
+        if (!file) {
+            throw std::runtime_error("Cannot open benchmark output: " + config.output);
+        }
+    }
+    std::ostream& out = config.output.empty() ? std::cout : file;
+
+    SortBenchmarkReporter reporter(out, config.format);
+    PerfCounterGroup perf;
+    if (!perf.available()) {
+        std::cerr << "perf_event counters unavailable, counter columns left empty" << std::endl;
+    }
+
+    std::vector<SortVariant> variants = sorting_benchmark_variants();
+    reporter.begin();
+
+    for (size_t n : config.sizes) {
+        for (SortDistribution distribution : config.distributions) {
+            // Input, working copy, reference and merge buffer
+            if (n * sizeof(int) * 4 > config.max_memory_bytes) {
+                std::cerr << "skipping n=" << n << ": over max_memory_bytes" << std::endl;
+                continue;
+            }
+
+            std::vector<int> keys = generate_sort_input(distribution, n, config.seed);
+            std::vector<int> expected = keys;
+            std::sort(expected.begin(), expected.end());
+
+            std::vector<BenchmarkRecord> records;
+            bool run_records = config.records && n * sizeof(BenchmarkRecord) * 4 <= config.max_memory_bytes;
+            if (run_records) {
+                records.reserve(n);
+                for (int key : keys) records.emplace_back(key);
+            }
+
+            for (const SortVariant& variant : variants) {
+                if (!sort_variant_runs(variant, distribution, n, config)) {
+                    continue;
+                }
+
+                SortBenchmarkResult result;
+                result.algorithm = variant.name;
+                result.family = variant.family;
+                result.distribution = sort_distribution_name(distribution);
+                result.n = n;
+
+                if (variant.sort_ints) {
+                    SortBenchmarkResult row = result;
+                    row.element = "int32";
+                    measure_sort(keys, expected, variant.sort_ints, config, perf, row);
+                    if (config.count_operations && variant.sort_counted && n <= config.count_limit) {
+                        count_sort_operations(keys, variant.sort_counted, row);
+                    }
+                    reporter.add(row);
+                }
+
+                if (run_records && variant.sort_records) {
+                    SortBenchmarkResult row = result;
+                    row.element = "record64";
+                    measure_sort(records, expected, variant.sort_records, config, perf, row);
+                    reporter.add(row);
+                }
+            }
+        }
+    }
+
+    reporter.end();
+}
+
+/**
+ * @brief Build a config from command-line flags
+ *
+ * Flags: --sizes=100,1000  --dist=random,sorted  --filter=quick
+ *        --format=csv|json  --out=results.csv  --min-time-ms=200
+ *        --quadratic-limit=20000  --max-memory-mb=4096  --seed=42
+ *        --no-records  --no-counts
+ */
+SortBenchmarkConfig parse_sorting_benchmark_args(int argc, char** argv) {
+    SortBenchmarkConfig config;
+
+    auto split = [](const std::string& list) {
+        std::vector<std::string> items;
+        std::stringstream ss(list);
+        std::string item;
+        while (std::getline(ss, item, ',')) {
+            if (!item.empty()) items.push_back(item);
+        }
+        return items;
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        size_t eq = arg.find('=');
+        std::string flag = arg.substr(0, eq);
+        std::string value = eq == std::string::npos ? "" : arg.substr(eq + 1);
+
+        if (flag == "--sizes") {
+            config.sizes.clear();
+            for (const auto& item : split(value)) {
+                config.sizes.push_back(static_cast<size_t>(std::stod(item)));  // accepts 1e6
+            }
+        } else if (flag == "--dist") {
+            config.distributions.clear();
+            for (const auto& item : split(value)) {
+                config.distributions.push_back(parse_sort_distribution(item));
+            }
+        } else if (flag == "--filter") {
+            config.filter = value;
+        } else if (flag == "--format") {
+            config.format = value;
+        } else if (flag == "--out") {
+            config.output = value;
+        } else if (flag == "--min-time-ms") {
+            config.min_time_ms = std::stod(value);
+        } else if (flag == "--quadratic-limit") {
+            config.quadratic_limit = static_cast<size_t>(std::stod(value));
+        } else if (flag == "--max-memory-mb") {
+            config.max_memory_bytes = static_cast<size_t>(std::stod(value)) << 20;
+        } else if (flag == "--seed") {
+            config.seed = static_cast<uint32_t>(std::stoul(value));
+        } else if (flag == "--no-records") {
+            config.records = false;
+        } else if (flag == "--no-counts") {
+            config.count_operations = false;
+        } else {
+            throw std::invalid_argument("Unknown flag: " + arg);
+        }
+    }
+    return config;
+}
+
+#if defined(SORTING_BENCHMARK_MAIN)
+int main(int argc, char** argv) {
+    try {
+        run_sorting_benchmarks(parse_sorting_benchmark_args(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
+#endif
@@ -0,0 +1,656 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include "00-SIMD Dispatch.cpp"  // SimdLevel, active_simd_level, set_simd_level
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define SORTING_NETWORK_USE_X86
+#define SORTING_NETWORK_AVX2 __attribute__((target("avx2")))
+#define SORTING_NETWORK_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SORTING_NETWORK_USE_NEON
+#endif
+
+/**
+ * @brief Sorting Networks (vectorized base case for hybrid sorts)
+ *
+ * A sorting network is a fixed sequence of compare-exchange steps that
+ * does not depend on the data. Every step is a min and a max, so there
+ * are no branches to mispredict, and the independent steps of one stage
+ * map onto SIMD lanes. That makes a network much faster than insertion
+ * sort for the last few dozen elements of a quick/merge sort partition.
+ *
+ * This file uses Batcher's bitonic network:
+ * - One register is sorted with in-register shuffles (8 lanes on AVX2,
+ *   16 on AVX-512, 4 on NEON)
+ * - Sorted registers are merged pairwise: reversing the second block
+ *   makes the pair bitonic, then min/max across registers and a final
+ *   in-register clean pass sort it
+ * - merge_sorted_blocks merges two long sorted arrays 8 elements at a
+ *   time with the same two-register bitonic merge
+ *
+ * Supported:
+ * - Element types: int32_t and float (NaN is not supported)
+ * - Fixed kernels for 8/16/32/64 elements, and sorting_network_sort for
+ *   any n <= 64 (padded up to the next kernel size with the maximum value)
+ * - Instruction sets: AVX-512, AVX2, NEON and a portable scalar network.
+ *   The best one the CPU supports is picked at runtime; the x86 kernels
+ *   are compiled with target attributes, so no -mavx2 flag is needed.
+ *
+ * Time Complexity: O(n log² n) comparators, all branch-free
+ * Space Complexity: O(1) (one 64-element padding buffer)
+ * Stable: No
+ */
+
+// Largest n handled by sorting_network_sort
+constexpr size_t sorting_network_max_size = 64;
+
+namespace network_detail {
+
+template <typename T>
+struct is_network_type
+    : std::integral_constant<bool, std::is_same<T, int32_t>::value || std::is_same<T, float>::value> {};
+
+/**
+ * @brief Branch-free compare-exchange: afterwards a <= b
+ */
+template <typename T>
+inline void compare_exchange(T& a, T& b) {
+    T lo = std::min(a, b);
+    T hi = std::max(a, b);
+    a = lo;
+    b = hi;
+}
+
+/**
+ * @brief Portable bitonic sort, n must be a power of two
+ *
+ * Within one (k, j) stage the direction only changes every k elements,
+ * so the inner loop is a plain run of min/max pairs the compiler can
+ * vectorize on its own.
+ */
+template <typename T>
+void bitonic_sort_scalar(T* data, size_t n) {
+    for (size_t k = 2; k <= n; k <<= 1) {
+        for (size_t j = k >> 1; j > 0; j >>= 1) {
+            for (size_t block = 0; block < n; block += 2 * j) {
+                T* lo = data + block;
+                T* hi = lo + j;
+                if ((block & k) == 0) {
+                    for (size_t t = 0; t < j; ++t) compare_exchange(lo[t], hi[t]);
+                } else {
+                    for (size_t t = 0; t < j; ++t) compare_exchange(hi[t], lo[t]);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Plain two-way merge (used for short inputs and tails)
+ */
+template <typename T>
+void merge_scalar(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        bool take_b = b[j] < a[i];
+        *out++ = take_b ? b[j] : a[i];
+        j += take_b;
+        i += !take_b;
+    }
+    while (i < na) *out++ = a[i++];
+    while (j < nb) *out++ = b[j++];
+}
+
+/**
+ * @brief Three-way merge for the tail of the vectorized merge
+ */
+template <typename T>
+void merge_three_scalar(const T* a, size_t na, const T* b, size_t nb, const T* c, size_t nc, T* out) {
+    size_t i = 0, j = 0, k = 0;
+    while (i < na && j < nb && k < nc) {
+        if (a[i] <= b[j] && a[i] <= c[k]) {
+            *out++ = a[i++];
+        } else if (b[j] <= c[k]) {
+            *out++ = b[j++];
+        } else {
+            *out++ = c[k++];
+        }
+    }
+    if (i == na) {
+        merge_scalar(b + j, nb - j, c + k, nc - k, out);
+    } else if (j == nb) {
+        merge_scalar(a + i, na - i, c + k, nc - k, out);
+    } else {
+        merge_scalar(a + i, na - i, b + j, nb - j, out);
+    }
+}
+
+#if defined(SORTING_NETWORK_USE_X86)
+
+/**
+ * @brief AVX2 kernels: 8 lanes per __m256i
+ *
+ * Both element types are kept in integer registers; only min/max differ.
+ */
+template <typename T>
+struct Avx2Ops;
+
+template <>
+struct Avx2Ops<int32_t> {
+    SORTING_NETWORK_AVX2 static __m256i min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+    SORTING_NETWORK_AVX2 static __m256i max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+};
+
+template <>
+struct Avx2Ops<float> {
+    SORTING_NETWORK_AVX2 static __m256i min(__m256i a, __m256i b) {
+        return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+    SORTING_NETWORK_AVX2 static __m256i max(__m256i a, __m256i b) {
+        return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b)));
+    }
+};
+
+/**
+ * @brief Sort a bitonic register: half-cleaners at distance 4, 2, 1
+ */
+template <typename T>
+SORTING_NETWORK_AVX2 inline __m256i avx2_clean(__m256i v) {
+    __m256i p = _mm256_permute2x128_si256(v, v, 0x01);
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xF0);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xCC);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xAA);
+    return v;
+}
+
+SORTING_NETWORK_AVX2 inline __m256i avx2_reverse(__m256i v) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/**
+ * @brief Sort the 8 lanes of one register
+ *
+ * Sorted pairs -> sorted quads -> sorted octet. Before each merge the
+ * upper half of every block is reversed, which makes the block bitonic.
+ */
+template <typename T>
+SORTING_NETWORK_AVX2 inline __m256i avx2_sort_register(__m256i v) {
+    __m256i p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xAA);
+
+    v = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 1, 0));
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xCC);
+    p = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+    v = _mm256_blend_epi32(Avx2Ops<T>::min(v, p), Avx2Ops<T>::max(v, p), 0xAA);
+
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 3, 7, 6, 5, 4));
+    return avx2_clean<T>(v);
+}
+
+/**
+ * @brief Merge sorted r[0, w) and r[w, 2w) into sorted r[0, 2w)
+ */
+template <typename T>
+SORTING_NETWORK_AVX2 inline void avx2_merge_registers(__m256i* r, size_t w) {
+    for (size_t i = 0; i < w / 2; ++i) {
+        std::swap(r[w + i], r[2 * w - 1 - i]);
+    }
+    for (size_t i = w; i < 2 * w; ++i) {
+        r[i] = avx2_reverse(r[i]);
+    }
+    for (size_t d = w; d > 0; d >>= 1) {
+        for (size_t i = 0; i < 2 * w; ++i) {
+            if ((i & d) == 0) {
+                __m256i lo = Avx2Ops<T>::min(r[i], r[i + d]);
+                r[i + d] = Avx2Ops<T>::max(r[i], r[i + d]);
+                r[i] = lo;
+            }
+        }
+    }
+    for (size_t i = 0; i < 2 * w; ++i) {
+        r[i] = avx2_clean<T>(r[i]);
+    }
+}
+
+/**
+ * @brief Sort 8 * regs elements in place (regs = 1, 2, 4 or 8)
+ */
+template <typename T>
+SORTING_NETWORK_AVX2 void avx2_sort_block(T* data, size_t regs) {
+    __m256i r[8];
+    for (size_t i = 0; i < regs; ++i) {
+        r[i] = avx2_sort_register<T>(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 8 * i)));
+    }
+    for (size_t w = 1; w < regs; w <<= 1) {
+        for (size_t base = 0; base < regs; base += 2 * w) {
+            avx2_merge_registers<T>(r + base, w);
+        }
+    }
+    for (size_t i = 0; i < regs; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + 8 * i), r[i]);
+    }
+}
+
+/**
+ * @brief Vectorized merge of two sorted arrays
+ *
+ * Keeps the 8 largest elements seen so far in a carry register. Each step
+ * loads the next 8 elements from whichever input has the smaller head,
+ * bitonic-merges them with the carry, and writes the lower 8 out.
+ */
+template <typename T>
+SORTING_NETWORK_AVX2 void avx2_merge(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    if (na < 8 || nb < 8) {
+        merge_scalar(a, na, b, nb, out);
+        return;
+    }
+
+    __m256i r[2];
+    r[0] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+    r[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+    size_t i = 8, j = 8;
+
+    while (true) {
+        avx2_merge_registers<T>(r, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), r[0]);
+        out += 8;
+        r[0] = r[1];
+
+        bool from_a;
+        if (i + 8 <= na && j + 8 <= nb) {
+            from_a = a[i] <= b[j];
+        } else if (i + 8 <= na && (j == nb || a[i] <= b[j])) {
+            from_a = true;
+        } else if (j + 8 <= nb && (i == na || b[j] <= a[i])) {
+            from_a = false;
+        } else {
+            break;
+        }
+
+        if (from_a) {
+            r[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+            i += 8;
+        } else {
+            r[1] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+            j += 8;
+        }
+    }
+
+    alignas(32) T carry[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(carry), r[0]);
+    merge_three_scalar(carry, 8, a + i, na - i, b + j, nb - j, out);
+}
+
+SIMD_AVX512_KERNELS_BEGIN
+
+/**
+ * @brief AVX-512 kernels: 16 lanes per __m512i
+ */
+template <typename T>
+struct Avx512Ops;
+
+template <>
+struct Avx512Ops<int32_t> {
+    SORTING_NETWORK_AVX512 static __m512i min(__m512i a, __m512i b) { return _mm512_min_epi32(a, b); }
+    SORTING_NETWORK_AVX512 static __m512i max(__m512i a, __m512i b) { return _mm512_max_epi32(a, b); }
+};
+
+template <>
+struct Avx512Ops<float> {
+    SORTING_NETWORK_AVX512 static __m512i min(__m512i a, __m512i b) {
+        return _mm512_castps_si512(_mm512_min_ps(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b)));
+    }
+    SORTING_NETWORK_AVX512 static __m512i max(__m512i a, __m512i b) {
+        return _mm512_castps_si512(_mm512_max_ps(_mm512_castsi512_ps(a), _mm512_castsi512_ps(b)));
+    }
+};
+
+/**
+ * @brief One half-cleaner step: lanes in mask take the max of (v, p)
+ */
+template <typename T>
+SORTING_NETWORK_AVX512 inline __m512i avx512_step(__m512i v, __m512i p, __mmask16 upper) {
+    return _mm512_mask_mov_epi32(Avx512Ops<T>::min(v, p), upper, Avx512Ops<T>::max(v, p));
+}
+
+template <typename T>
+SORTING_NETWORK_AVX512 inline __m512i avx512_clean_from(__m512i v, int distance) {
+    if (distance >= 8) v = avx512_step<T>(v, _mm512_shuffle_i64x2(v, v, _MM_SHUFFLE(1, 0, 3, 2)), 0xFF00);
+    if (distance >= 4) v = avx512_step<T>(v, _mm512_shuffle_i64x2(v, v, _MM_SHUFFLE(2, 3, 0, 1)), 0xF0F0);
+    if (distance >= 2) v = avx512_step<T>(v, _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(1, 0, 3, 2)), 0xCCCC);
+    return avx512_step<T>(v, _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(2, 3, 0, 1)), 0xAAAA);
+}
+
+SORTING_NETWORK_AVX512 inline __m512i avx512_reverse(__m512i v) {
+    return _mm512_permutexvar_epi32(_mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+}
+
+/**
+ * @brief Sort the 16 lanes of one register (same scheme as AVX2, one level deeper)
+ */
+template <typename T>
+SORTING_NETWORK_AVX512 inline __m512i avx512_sort_register(__m512i v) {
+    v = avx512_clean_from<T>(v, 1);
+    v = _mm512_shuffle_epi32(v, (_MM_PERM_ENUM)_MM_SHUFFLE(2, 3, 1, 0));
+    v = avx512_clean_from<T>(v, 2);
+    v = _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 1, 2, 3, 7, 6, 5, 4, 8, 9, 10, 11, 15, 14, 13, 12), v);
+    v = avx512_clean_from<T>(v, 4);
+    v = _mm512_permutexvar_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 15, 14, 13, 12, 11, 10, 9, 8), v);
+    return avx512_clean_from<T>(v, 8);
+}
+
+/**
+ * @brief Sort 16 * regs elements in place (regs = 1, 2 or 4)
+ */
+template <typename T>
+SORTING_NETWORK_AVX512 void avx512_sort_block(T* data, size_t regs) {
+    __m512i r[4];
+    for (size_t i = 0; i < regs; ++i) {
+        r[i] = avx512_sort_register<T>(_mm512_loadu_si512(data + 16 * i));
+    }
+    for (size_t w = 1; w < regs; w <<= 1) {
+        for (size_t base = 0; base < regs; base += 2 * w) {
+            __m512i* block = r + base;
+            for (size_t i = 0; i < w / 2; ++i) {
+                std::swap(block[w + i], block[2 * w - 1 - i]);
+            }
+            for (size_t i = w; i < 2 * w; ++i) {
+                block[i] = avx512_reverse(block[i]);
+            }
+            for (size_t d = w; d > 0; d >>= 1) {
+                for (size_t i = 0; i < 2 * w; ++i) {
+                    if ((i & d) == 0) {
+                        __m512i lo = Avx512Ops<T>::min(block[i], block[i + d]);
+                        block[i + d] = Avx512Ops<T>::max(block[i], block[i + d]);
+                        block[i] = lo;
+                    }
+                }
+            }
+            for (size_t i = 0; i < 2 * w; ++i) {
+                block[i] = avx512_clean_from<T>(block[i], 8);
+            }
+        }
+    }
+    for (size_t i = 0; i < regs; ++i) {
+        _mm512_storeu_si512(data + 16 * i, r[i]);
+    }
+}
+
+SIMD_AVX512_KERNELS_END
+
+#endif  // SORTING_NETWORK_USE_X86
+
+#if defined(SORTING_NETWORK_USE_NEON)
+
+/**
+ * @brief NEON kernels: 4 lanes per int32x4_t (floats reinterpreted)
+ */
+template <typename T>
+struct NeonOps;
+
+template <>
+struct NeonOps<int32_t> {
+    static int32x4_t min(int32x4_t a, int32x4_t b) { return vminq_s32(a, b); }
+    static int32x4_t max(int32x4_t a, int32x4_t b) { return vmaxq_s32(a, b); }
+};
+
+template <>
+struct NeonOps<float> {
+    static int32x4_t min(int32x4_t a, int32x4_t b) {
+        return vreinterpretq_s32_f32(vminq_f32(vreinterpretq_f32_s32(a), vreinterpretq_f32_s32(b)));
+    }
+    static int32x4_t max(int32x4_t a, int32x4_t b) {
+        return vreinterpretq_s32_f32(vmaxq_f32(vreinterpretq_f32_s32(a), vreinterpretq_f32_s32(b)));
+    }
+};
+
+template <typename T>
+inline int32x4_t neon_clean(int32x4_t v) {
+    int32x4_t p = vextq_s32(v, v, 2);
+    v = vcombine_s32(vget_low_s32(NeonOps<T>::min(v, p)), vget_high_s32(NeonOps<T>::max(v, p)));
+    p = vrev64q_s32(v);
+    return vtrn1q_s32(NeonOps<T>::min(v, p), NeonOps<T>::max(v, p));
+}
+
+inline int32x4_t neon_reverse(int32x4_t v) {
+    v = vrev64q_s32(v);
+    return vextq_s32(v, v, 2);
+}
+
+template <typename T>
+inline int32x4_t neon_sort_register(int32x4_t v) {
+    int32x4_t p = vrev64q_s32(v);
+    v = vtrn1q_s32(NeonOps<T>::min(v, p), NeonOps<T>::max(v, p));
+    v = vcombine_s32(vget_low_s32(v), vrev64_s32(vget_high_s32(v)));
+    return neon_clean<T>(v);
+}
+
+/**
+ * @brief Sort 4 * regs elements in place (regs = 2, 4, 8 or 16)
+ */
+template <typename T>
+void neon_sort_block(T* data, size_t regs) {
+    int32x4_t r[16];
+    for (size_t i = 0; i < regs; ++i) {
+        r[i] = neon_sort_register<T>(vld1q_s32(reinterpret_cast<const int32_t*>(data + 4 * i)));
+    }
+    for (size_t w = 1; w < regs; w <<= 1) {
+        for (size_t base = 0; base < regs; base += 2 * w) {
+            int32x4_t* block = r + base;
+            for (size_t i = 0; i < w / 2; ++i) {
+                std::swap(block[w + i], block[2 * w - 1 - i]);
+            }
+            for (size_t i = w; i < 2 * w; ++i) {
+                block[i] = neon_reverse(block[i]);
+            }
+            for (size_t d = w; d > 0; d >>= 1) {
+                for (size_t i = 0; i < 2 * w; ++i) {
+                    if ((i & d) == 0) {
+                        int32x4_t lo = NeonOps<T>::min(block[i], block[i + d]);
+                        block[i + d] = NeonOps<T>::max(block[i], block[i + d]);
+                        block[i] = lo;
+                    }
+                }
+            }
+            for (size_t i = 0; i < 2 * w; ++i) {
+                block[i] = neon_clean<T>(block[i]);
+            }
+        }
+    }
+    for (size_t i = 0; i < regs; ++i) {
+        vst1q_s32(reinterpret_cast<int32_t*>(data + 4 * i), r[i]);
+    }
+}
+
+#endif  // SORTING_NETWORK_USE_NEON
+
+/**
+ * @brief Sort exactly n elements, n in {8, 16, 32, 64}
+ */
+template <typename T>
+void sort_kernel(T* data, size_t n) {
+    switch (active_simd_level()) {
+#if defined(SORTING_NETWORK_USE_X86)
+        case SimdLevel::Avx512:
+            if (n >= 16) {
+                avx512_sort_block(data, n / 16);
+                return;
+            }
+            avx2_sort_block(data, 1);
+            return;
+        case SimdLevel::Avx2:
+            avx2_sort_block(data, n / 8);
+            return;
+#endif
+#if defined(SORTING_NETWORK_USE_NEON)
+        case SimdLevel::Neon:
+            neon_sort_block(data, n / 4);
+            return;
+#endif
+        default:
+            bitonic_sort_scalar(data, n);
+            return;
+    }
+}
+
+}  // namespace network_detail
+
+/**
+ * @brief Sort exactly N elements with a sorting network (N = 8, 16, 32 or 64)
+ * @param data Pointer to N elements of int32_t or float
+ */
+template <size_t N, typename T>
+void sorting_network_sort_fixed(T* data) {
+    static_assert(network_detail::is_network_type<T>::value, "Sorting networks support int32_t and float");
+    static_assert(N == 8 || N == 16 || N == 32 || N == 64, "Kernel sizes are 8, 16, 32 and 64");
+    network_detail::sort_kernel(data, N);
+}
+
+/**
+ * @brief Sort up to 64 elements with a sorting network
+ *
+ * The input is copied into a buffer padded with the largest value up to
+ * the next kernel size, sorted there and copied back.
+ *
+ * @param data Pointer to the elements
+ * @param n Number of elements (at most sorting_network_max_size)
+ */
+template <typename T>
+void sorting_network_sort(T* data, size_t n) {
+    static_assert(network_detail::is_network_type<T>::value, "Sorting networks support int32_t and float");
+    if (n > sorting_network_max_size) {
+        throw std::invalid_argument("sorting_network_sort handles at most 64 elements");
+    }
+    if (n < 2) return;
+
+    size_t kernel = 8;
+    while (kernel < n) kernel <<= 1;
+
+    alignas(64) T buffer[sorting_network_max_size];
+    std::copy(data, data + n, buffer);
+    std::fill(buffer + n, buffer + kernel,
+              std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                   : std::numeric_limits<T>::max());
+    network_detail::sort_kernel(buffer, kernel);
+    std::copy(buffer, buffer + n, data);
+}
+
+/**
+ * @brief Merge two sorted arrays into out (out must not overlap the inputs)
+ *
+ * Uses the 8-wide bitonic merge on AVX2/AVX-512 and a branch-free scalar
+ * merge elsewhere.
+ */
+template <typename T>
+void merge_sorted_blocks(const T* a, size_t na, const T* b, size_t nb, T* out) {
+    static_assert(network_detail::is_network_type<T>::value, "Sorting networks support int32_t and float");
+#if defined(SORTING_NETWORK_USE_X86)
+    if (active_simd_level() >= SimdLevel::Avx2) {
+        network_detail::avx2_merge(a, na, b, nb, out);
+        return;
+    }
+#endif
+    network_detail::merge_scalar(a, na, b, nb, out);
+}
+
+/**
+ * @brief Test function for the sorting network kernels
+ */
+void test_sorting_networks() {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int32_t> dist(-1000, 1000);
+    SimdLevel best = detect_simd_level();
+
+    std::cout << "\n=== Sorting Networks (detected " << simd_level_name(best) << ") ===" << std::endl;
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        set_simd_level(level);
+        if (active_simd_level() != level) continue;
+
+        bool ok = true;
+        for (size_t n = 0; n <= sorting_network_max_size; ++n) {
+            std::vector<int32_t> v(n);
+            for (auto& x : v) x = dist(rng);
+            std::vector<float> f(v.begin(), v.end());
+            auto expected = v;
+            std::sort(expected.begin(), expected.end());
+
+            sorting_network_sort(v.data(), n);
+            sorting_network_sort(f.data(), n);
+            ok = ok && v == expected && std::equal(f.begin(), f.end(), expected.begin());
+        }
+
+        std::vector<int32_t> a(1000), b(777), merged(a.size() + b.size());
+        for (auto& x : a) x = dist(rng);
+        for (auto& x : b) x = dist(rng);
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+        merge_sorted_blocks(a.data(), a.size(), b.data(), b.size(), merged.data());
+        ok = ok && std::is_sorted(merged.begin(), merged.end());
+
+        std::cout << simd_level_name(level) << ": " << (ok ? "ok" : "FAILED") << std::endl;
+    }
+    set_simd_level(best);
+}
+
+/**
+ * @brief Networks vs insertion sort on many short arrays
+ * @param arrays Number of arrays per size
+ */
+void compare_sorting_networks(size_t arrays = 200000) {
+    std::mt19937 rng(42);
+    SimdLevel best = detect_simd_level();
+
+    std::cout << "\n=== Short-array sorting (" << arrays << " arrays per size, ns per array) ===" << std::endl;
+
+    for (size_t n : {8, 16, 32, 64}) {
+        std::vector<int32_t> data(arrays * n);
+        for (auto& x : data) x = static_cast<int32_t>(rng());
+
+        auto run = [&](auto&& sort_one) {
+            auto copy = data;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (size_t a = 0; a < arrays; ++a) sort_one(copy.data() + a * n);
+            auto end = std::chrono::high_resolution_clock::now();
+            return std::chrono::duration<double, std::nano>(end - start).count() / arrays;
+        };
+
+        double insertion = run([n](int32_t* p) {
+            for (size_t i = 1; i < n; ++i) {
+                int32_t key = p[i];
+                size_t j = i;
+                while (j > 0 && p[j - 1] > key) {
+                    p[j] = p[j - 1];
+                    --j;
+                }
+                p[j] = key;
+            }
+        });
+        double stl = run([n](int32_t* p) { std::sort(p, p + n); });
+
+        std::cout << "n=" << n << ": insertion " << insertion << ", std::sort " << stl;
+        for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512, SimdLevel::Neon}) {
+            set_simd_level(level);
+            if (active_simd_level() != level) continue;
+            std::cout << ", " << simd_level_name(level) << " " << run([n](int32_t* p) { sorting_network_sort(p, n); });
+        }
+        std::cout << std::endl;
+    }
+    set_simd_level(best);
+}
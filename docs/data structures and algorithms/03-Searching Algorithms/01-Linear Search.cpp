@@ -180,30 +180,31 @@ ListNode* linear_search_linked_list(ListNode* head, int target) {
 }
 
 /**
- * @brief Linear Search with sentinel value
- * Adds sentinel value to avoid boundary checks
- * @param arr Array to search in (will be modified)
+ * @brief Linear Search with the bounds check hoisted out of the inner loop
+ *
+ * The classic sentinel trick writes target over the last element so the
+ * loop needs no bounds check, then restores it. That is a data race as
+ * soon as another thread reads the array, and it cannot work on const
+ * data. Checking the bound once per four elements gets most of the same
+ * saving without writing anything (linear_search_simd goes further and
+ * compares a whole register at a time).
+ *
+ * @param arr Array to search in (not modified)
  * @param target Value to search for
  * @return Index of target if found, -1 otherwise
  */
-int linear_search_sentinel(std::vector<int>& arr, int target) {
-    if (arr.empty()) return -1;
-
-    // Store last element and place sentinel
-    int last = arr.back();
-    arr.back() = target;
-
-    int i = 0;
-    while (arr[i] != target) {
-        i++;
+int linear_search_unrolled(const std::vector<int>& arr, int target) {
+    size_t n = arr.size();
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        if (arr[i] == target) return static_cast<int>(i);
+        if (arr[i + 1] == target) return static_cast<int>(i + 1);
+        if (arr[i + 2] == target) return static_cast<int>(i + 2);
+        if (arr[i + 3] == target) return static_cast<int>(i + 3);
     }
-
-    // Restore last element
-    arr.back() = last;
-
-    // Check if we found actual target or reached sentinel
-    if (i < static_cast<int>(arr.size()) - 1 || arr.back() == target) {
-        return i;
+    for (; i < n; ++i) {
+        if (arr[i] == target) return static_cast<int>(i);
     }
 
     return -1;
@@ -464,10 +465,10 @@ void compare_search_performance() {
 }
 
 /**
- * @brief Test sentinel optimization
+ * @brief Test the unrolled search against the counting one
  */
-void test_sentinel_search() {
-    std::cout << "\n=== Testing Sentinel Search ===" << std::endl;
+void test_unrolled_search() {
+    std::cout << "\n=== Testing Unrolled Search ===" << std::endl;
 
     std::vector<int> arr = {64, 34, 25, 12, 22, 11, 90};
     print_array(arr, "Original array");
@@ -478,11 +479,10 @@ void test_sentinel_search() {
     int comparisons1;
     int result1 = linear_search_with_count(arr, target, comparisons1);
 
-    // Sentinel linear search (needs modifiable array)
-    std::vector<int> arr_copy = arr;
-    int result2 = linear_search_sentinel(arr_copy, target);
+    // Unrolled search (leaves the array untouched)
+    int result2 = linear_search_unrolled(arr, target);
 
     std::cout << "Regular search: " << result1 << ", comparisons: " << comparisons1 << std::endl;
-    std::cout << "Sentinel search: " << result2 << std::endl;
+    std::cout << "Unrolled search: " << result2 << std::endl;
     std::cout << "Both methods found the same result: " << (result1 == result2 ? "Yes" : "No") << std::endl;
 }
\ No newline at end of file
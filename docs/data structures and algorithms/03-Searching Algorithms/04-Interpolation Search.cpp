@@ -240,7 +240,10 @@ int interpolation_search_float(const std::vector<double>& arr, double target, do
 
 /**
  * @brief Interpolation Search with exponential backoff
- * Falls back to binary search when interpolation estimates are poor
+ * Falls back to binary search when interpolation estimates are poor.
+ * Still one line over the whole remaining range; for skewed keys that are
+ * searched repeatedly, LearnedIndex (Learned Index) fits many local lines
+ * once and bounds every lookup to a few dozen positions.
  * @param arr Sorted array to search in
  * @param target Value to search for
  * @return Index of target if found, -1 otherwise
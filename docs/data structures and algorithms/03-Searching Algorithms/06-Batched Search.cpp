@@ -0,0 +1,409 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @brief Batched Search (many keys against one sorted array)
+ *
+ * A single binary search over a large array is a chain of dependent cache
+ * misses: the next probe address is unknown until the current load
+ * returns, so the core sits idle for most of each ~100 ns miss. When many
+ * keys are probed against the same array (a join, a bulk lookup), the
+ * searches for different keys are independent, and running them together
+ * hides that latency:
+ *
+ * - Interleaving (group prefetching): a group of keys descends in
+ *   lockstep. Each round issues a prefetch for every key's next probe
+ *   before any of them is loaded, so up to group_size misses are in flight
+ *   at once instead of one.
+ * - Sorted probes: visiting keys in ascending order makes consecutive
+ *   searches share most of their path, so the probes hit cache. For
+ *   exponential search it also turns every lookup into a short gallop from
+ *   the previous answer.
+ * - Threads: a large batch is split into contiguous chunks, one per thread.
+ *
+ * Results are written in the order of the input keys regardless of any
+ * internal reordering.
+ *
+ * Time Complexity: O(m log n) for m keys, with up to group_size misses
+ * overlapped; sorted exponential search is O(m log m + m log(n/m))
+ * Space Complexity: O(group_size), plus O(m) when probes are sorted
+ */
+
+/**
+ * @brief Tuning knobs shared by the batch searches
+ */
+struct BatchSearchOptions {
+    size_t group_size = 16;                // Keys descending in lockstep
+    bool sort_probes = false;              // Visit keys in ascending order
+    unsigned threads = 1;                  // 0 = one per hardware thread
+    size_t min_keys_per_thread = 1 << 14;  // Smaller batches stay on one thread
+};
+
+namespace batch_detail {
+
+constexpr size_t max_group_size = 64;
+
+inline void prefetch_read(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    (void)address;
+#endif
+}
+
+/**
+ * @brief Run body(begin, end) over [0, count) split across the configured threads
+ */
+template <typename Body>
+void run_chunks(size_t count, const BatchSearchOptions& options, Body body) {
+    unsigned threads = options.threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : options.threads;
+    size_t by_size = std::max<size_t>(1, count / std::max<size_t>(1, options.min_keys_per_thread));
+    threads = static_cast<unsigned>(std::min<size_t>(threads, by_size));
+
+    if (threads <= 1) {
+        body(size_t(0), count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    size_t chunk = (count + threads - 1) / threads;
+    for (unsigned t = 1; t < threads; ++t) {
+        size_t begin = std::min(count, t * chunk);
+        size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([=, &body] { body(begin, end); });
+    }
+    body(size_t(0), std::min(count, chunk));
+    for (auto& worker : workers) worker.join();
+}
+
+/**
+ * @brief Lower bounds of count (<= max_group_size) keys, descending in lockstep
+ *
+ * Branch-free halving: every key does the same number of steps, so one
+ * loop counter drives the whole group. Before each step, both possible
+ * next probes of every key are prefetched. With ExactMatch the result is
+ * the index of the key or -1, checked while its line is still in cache.
+ */
+template <bool ExactMatch, typename T>
+void lower_bound_group(const T* base, size_t n, const T* const* keys, size_t count, int* const* out) {
+    size_t low[max_group_size];
+    for (size_t g = 0; g < count; ++g) low[g] = 0;
+
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        size_t next_half = (len - half) / 2;
+        for (size_t g = 0; g < count; ++g) {
+            prefetch_read(base + low[g] + next_half);
+            prefetch_read(base + low[g] + half + next_half);
+        }
+        for (size_t g = 0; g < count; ++g) {
+            low[g] += (base[low[g] + half] < *keys[g]) ? half : 0;
+        }
+        len -= half;
+    }
+
+    for (size_t g = 0; g < count; ++g) {
+        size_t pos = low[g] + (n > 0 && base[low[g]] < *keys[g] ? 1 : 0);
+        if (ExactMatch && (pos == n || *keys[g] < base[pos])) {
+            *out[g] = -1;
+        } else {
+            *out[g] = static_cast<int>(pos);
+        }
+    }
+}
+
+/**
+ * @brief Lower bounds for keys[order[begin..end)] (order may be null for identity)
+ */
+template <bool ExactMatch, typename T>
+void lower_bound_range(const std::vector<T>& arr, const T* targets, const size_t* order,
+                       size_t begin, size_t end, int* out, size_t group_size) {
+    const T* keys[max_group_size];
+    int* outs[max_group_size];
+    for (size_t i = begin; i < end; i += group_size) {
+        size_t count = std::min(group_size, end - i);
+        for (size_t g = 0; g < count; ++g) {
+            size_t idx = order ? order[i + g] : i + g;
+            keys[g] = targets + idx;
+            outs[g] = out + idx;
+        }
+        lower_bound_group<ExactMatch>(arr.data(), arr.size(), keys, count, outs);
+    }
+}
+
+/**
+ * @brief Positions of targets in ascending key order
+ */
+template <typename T>
+std::vector<size_t> sorted_order(const T* targets, size_t count) {
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [targets](size_t a, size_t b) { return targets[a] < targets[b]; });
+    return order;
+}
+
+inline void check_group_size(const BatchSearchOptions& options) {
+    if (options.group_size == 0 || options.group_size > max_group_size) {
+        throw std::invalid_argument("BatchSearchOptions::group_size must be in [1, 64]");
+    }
+}
+
+template <bool ExactMatch, typename T>
+void interleaved_batch(const std::vector<T>& arr, const T* targets, size_t count, int* out,
+                       const BatchSearchOptions& options) {
+    check_group_size(options);
+    std::vector<size_t> order;
+    if (options.sort_probes) order = sorted_order(targets, count);
+    const size_t* order_ptr = options.sort_probes ? order.data() : nullptr;
+
+    run_chunks(count, options, [&](size_t begin, size_t end) {
+        lower_bound_range<ExactMatch>(arr, targets, order_ptr, begin, end, out, options.group_size);
+    });
+}
+
+} // namespace batch_detail
+
+/**
+ * @brief Insertion point (std::lower_bound) of every target, computed in interleaved groups
+ * @param arr Sorted array to search in
+ * @param targets Keys to look up
+ * @param count Number of keys
+ * @param out Receives count insertion points, out[i] for targets[i]
+ * @param options Group size, probe sorting and threading
+ * @throws std::invalid_argument if options.group_size is 0 or above 64
+ */
+template <typename T>
+void lower_bound_batch(const std::vector<T>& arr, const T* targets, size_t count, int* out,
+                       const BatchSearchOptions& options = BatchSearchOptions()) {
+    batch_detail::interleaved_batch<false>(arr, targets, count, out, options);
+}
+
+/**
+ * @brief Batched binary_search: index of each target, -1 if absent
+ *
+ * For duplicate keys this returns the first occurrence (like
+ * binary_search_first_occurrence), whereas binary_search_iterative may
+ * return any of them.
+ *
+ * @param arr Sorted array to search in
+ * @param targets Keys to look up
+ * @param count Number of keys
+ * @param out Receives count results, out[i] for targets[i]
+ * @param options Group size, probe sorting and threading
+ * @throws std::invalid_argument if options.group_size is 0 or above 64
+ */
+template <typename T>
+void binary_search_batch(const std::vector<T>& arr, const T* targets, size_t count, int* out,
+                         const BatchSearchOptions& options = BatchSearchOptions()) {
+    batch_detail::interleaved_batch<true>(arr, targets, count, out, options);
+}
+
+/**
+ * @brief Vector form of binary_search_batch; out is resized to targets.size()
+ */
+template <typename T>
+void binary_search_batch(const std::vector<T>& arr, const std::vector<T>& targets, std::vector<int>& out,
+                         const BatchSearchOptions& options = BatchSearchOptions()) {
+    out.resize(targets.size());
+    binary_search_batch(arr, targets.data(), targets.size(), out.data(), options);
+}
+
+/**
+ * @brief Batched exponential search over probes visited in ascending order
+ *
+ * Each key gallops forward from the previous key's answer (1, 2, 4, ...
+ * steps) and then binary searches the bracket, so a batch costs about
+ * log(gap) per key instead of log(n). Probes are always sorted here;
+ * options.sort_probes is ignored.
+ *
+ * @return Through out: index of the first occurrence of each target, -1 if absent
+ */
+template <typename T>
+void exponential_search_batch(const std::vector<T>& arr, const T* targets, size_t count, int* out,
+                              const BatchSearchOptions& options = BatchSearchOptions()) {
+    std::vector<size_t> order = batch_detail::sorted_order(targets, count);
+    size_t n = arr.size();
+
+    batch_detail::run_chunks(count, options, [&](size_t begin, size_t end) {
+        if (begin == end) return;
+        // Each chunk starts from a full search, then gallops
+        size_t pos = std::lower_bound(arr.begin(), arr.end(), targets[order[begin]]) - arr.begin();
+        for (size_t i = begin; i < end; ++i) {
+            const T& target = targets[order[i]];
+            size_t bound = 1;
+            while (pos + bound <= n && arr[pos + bound - 1] < target) bound *= 2;
+            size_t low = pos + bound / 2;
+            size_t high = std::min(n, pos + bound);
+            pos = std::lower_bound(arr.begin() + std::min(low, high), arr.begin() + high, target) - arr.begin();
+
+            out[order[i]] = (pos < n && !(target < arr[pos])) ? static_cast<int>(pos) : -1;
+        }
+    });
+}
+
+/**
+ * @brief Vector form of exponential_search_batch; out is resized to targets.size()
+ */
+template <typename T>
+void exponential_search_batch(const std::vector<T>& arr, const std::vector<T>& targets, std::vector<int>& out,
+                              const BatchSearchOptions& options = BatchSearchOptions()) {
+    out.resize(targets.size());
+    exponential_search_batch(arr, targets.data(), targets.size(), out.data(), options);
+}
+
+/**
+ * @brief Run any single-key searcher over a batch, with optional probe sorting and threads
+ *
+ * For searchers that cannot be interleaved step by step (jump search,
+ * interpolation search, StaticSearchIndex queries), this still gets the
+ * cache reuse of sorted probes and the parallelism:
+ *
+ *   search_batch(targets, out, [&](int t) { return jump_search_basic(arr, t); }, options);
+ *
+ * @param targets Keys to look up
+ * @param count Number of keys
+ * @param out Receives searcher(targets[i]) in out[i]
+ * @param searcher Callable taking a key and returning an int
+ * @param options Probe sorting and threading (group_size is unused)
+ */
+template <typename T, typename Searcher>
+void search_batch(const T* targets, size_t count, int* out, Searcher searcher,
+                  const BatchSearchOptions& options = BatchSearchOptions()) {
+    std::vector<size_t> order;
+    if (options.sort_probes) order = batch_detail::sorted_order(targets, count);
+
+    batch_detail::run_chunks(count, options, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            size_t idx = options.sort_probes ? order[i] : i;
+            out[idx] = searcher(targets[idx]);
+        }
+    });
+}
+
+template <typename T, typename Searcher>
+void search_batch(const std::vector<T>& targets, std::vector<int>& out, Searcher searcher,
+                  const BatchSearchOptions& options = BatchSearchOptions()) {
+    out.resize(targets.size());
+    search_batch(targets.data(), targets.size(), out.data(), searcher, options);
+}
+
+/**
+ * @brief Check the batch searches against std::lower_bound
+ */
+void test_batched_search() {
+    std::cout << "\n=== Testing Batched Search ===" << std::endl;
+
+    std::mt19937 rng(3);
+    bool all_ok = true;
+
+    for (size_t n : {0, 1, 2, 7, 64, 1000, 100000}) {
+        std::vector<int> arr(n);
+        for (auto& x : arr) x = static_cast<int>(rng() % (n * 2 + 1));
+        std::sort(arr.begin(), arr.end());
+
+        std::vector<int> targets(5000);
+        for (auto& t : targets) t = static_cast<int>(rng() % (n * 2 + 3)) - 1;
+
+        std::vector<int> expected(targets.size());
+        for (size_t i = 0; i < targets.size(); ++i) {
+            auto it = std::lower_bound(arr.begin(), arr.end(), targets[i]);
+            expected[i] = (it != arr.end() && *it == targets[i]) ? static_cast<int>(it - arr.begin()) : -1;
+        }
+
+        for (bool sorted : {false, true}) {
+            for (unsigned threads : {1u, 4u}) {
+                BatchSearchOptions options;
+                options.sort_probes = sorted;
+                options.threads = threads;
+                options.min_keys_per_thread = 100;
+                options.group_size = sorted ? 7 : 16;
+
+                std::vector<int> out;
+                binary_search_batch(arr, targets, out, options);
+                all_ok = all_ok && out == expected;
+
+                exponential_search_batch(arr, targets, out, options);
+                all_ok = all_ok && out == expected;
+
+                search_batch(targets, out, [&](int t) {
+                    auto it = std::lower_bound(arr.begin(), arr.end(), t);
+                    return (it != arr.end() && *it == t) ? static_cast<int>(it - arr.begin()) : -1;
+                }, options);
+                all_ok = all_ok && out == expected;
+            }
+        }
+    }
+
+    std::cout << (all_ok ? "All batch results match std::lower_bound" : "FAILED") << std::endl;
+}
+
+/**
+ * @brief Time one-at-a-time binary search against the batch modes
+ * @param n Number of keys in the sorted array
+ * @param queries Number of lookups
+ */
+void compare_batched_search(size_t n = 10000000, size_t queries = 2000000) {
+    std::cout << "\n=== Batched Search (" << n << " keys, " << queries << " lookups) ===" << std::endl;
+
+    std::vector<int> arr(n);
+    for (size_t i = 0; i < n; ++i) arr[i] = static_cast<int>(i * 2);
+
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> dist(0, static_cast<int>(n * 2));
+    std::vector<int> targets(queries);
+    for (auto& t : targets) t = dist(rng);
+
+    std::vector<int> out(queries);
+    auto time_ns = [&](auto&& run) {
+        auto start = std::chrono::high_resolution_clock::now();
+        run();
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count() / queries;
+    };
+
+    // Same loop as binary_search_iterative
+    double single = time_ns([&] {
+        for (size_t i = 0; i < queries; ++i) {
+            int left = 0, right = static_cast<int>(n) - 1, result = -1;
+            while (left <= right) {
+                int mid = left + (right - left) / 2;
+                if (arr[mid] == targets[i]) { result = mid; break; }
+                if (arr[mid] < targets[i]) left = mid + 1; else right = mid - 1;
+            }
+            out[i] = result;
+        }
+    });
+    std::cout << "one at a time:          " << single << " ns/lookup" << std::endl;
+
+    for (size_t group : {4, 8, 16, 32}) {
+        BatchSearchOptions options;
+        options.group_size = group;
+        double ns = time_ns([&] { binary_search_batch(arr, targets, out, options); });
+        std::cout << "interleaved, group " << group << (group < 10 ? ":  " : ": ") << "   " << ns
+                  << " ns/lookup (" << single / ns << "x)" << std::endl;
+    }
+
+    BatchSearchOptions sorted;
+    sorted.sort_probes = true;
+    double ns = time_ns([&] { binary_search_batch(arr, targets, out, sorted); });
+    std::cout << "interleaved + sorted:   " << ns << " ns/lookup (" << single / ns << "x)" << std::endl;
+
+    ns = time_ns([&] { exponential_search_batch(arr, targets, out); });
+    std::cout << "exponential, sorted:    " << ns << " ns/lookup (" << single / ns << "x)" << std::endl;
+
+    BatchSearchOptions parallel;
+    parallel.threads = 0;
+    ns = time_ns([&] { binary_search_batch(arr, targets, out, parallel); });
+    std::cout << "interleaved, " << std::max(1u, std::thread::hardware_concurrency()) << " threads: "
+              << ns << " ns/lookup (" << single / ns << "x)" << std::endl;
+}
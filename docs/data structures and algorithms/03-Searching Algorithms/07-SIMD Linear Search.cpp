@@ -0,0 +1,891 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include "../02-Sorting Algorithms/00-SIMD Dispatch.cpp"  // SimdLevel, active_simd_level
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define LINEAR_SCAN_USE_X86
+#define LINEAR_SCAN_AVX2 __attribute__((target("avx2")))
+#define LINEAR_SCAN_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define LINEAR_SCAN_USE_NEON
+#endif
+
+/**
+ * @brief SIMD Linear Search (vectorized and multithreaded scans)
+ *
+ * The linear searches in Linear Search compare one element per iteration
+ * and branch on every comparison. These versions compare a whole register
+ * at a time (8 or 16 int32/float lanes, 4 or 8 int64 lanes), turn the
+ * lane results into a bit mask, and only branch once per four registers:
+ * a non-zero mask ends the scan and the lowest set bit is the match.
+ *
+ * - Instruction sets: AVX-512, AVX2, NEON and scalar, picked at runtime
+ *   with the same SimdLevel switch the sorting networks use (so
+ *   set_simd_level() also forces the scans down a level)
+ * - Element types: int32_t, int64_t and float (NaN is never found and is
+ *   not supported by the min/max scans)
+ * - Arrays of at least ScanOptions::parallel_threshold elements are split
+ *   into one contiguous chunk per thread. Searches for a first/last match
+ *   stop early once another thread has found a better one.
+ *
+ * Nothing is written to the input, so the scans are safe on arrays shared
+ * between threads.
+ *
+ * Time Complexity: O(n / lanes) per thread; large scans are memory bound
+ * Space Complexity: O(1), or O(matches) for linear_search_all_simd
+ */
+
+/**
+ * @brief When and how widely the scans run in parallel
+ */
+struct ScanOptions {
+    unsigned threads = 0;                             // 0 = one per hardware thread
+    size_t parallel_threshold = size_t(1) << 22;      // Smaller arrays are scanned on one thread
+};
+
+namespace scan_detail {
+
+template <typename T>
+struct is_scan_type
+    : std::integral_constant<bool, std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value ||
+                                       std::is_same<T, float>::value> {};
+
+// min/max scans are done in blocks this size; a block that improves on
+// the best value is rescanned for its index while still in L1
+constexpr size_t extreme_block = 4096;
+
+// Granularity at which parallel first/last searches check for an earlier hit
+constexpr size_t parallel_step = size_t(1) << 16;
+
+template <typename T>
+size_t scalar_find_first(const T* data, size_t n, T target) {
+    for (size_t i = 0; i < n; ++i) {
+        if (data[i] == target) return i;
+    }
+    return n;
+}
+
+template <typename T>
+size_t scalar_find_last(const T* data, size_t n, T target) {
+    for (size_t i = n; i-- > 0;) {
+        if (data[i] == target) return i;
+    }
+    return n;
+}
+
+template <typename T>
+size_t scalar_count(const T* data, size_t n, T target) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; ++i) count += data[i] == target;
+    return count;
+}
+
+template <bool Max, typename T>
+T scalar_extreme(const T* data, size_t n) {
+    T best = data[0];
+    for (size_t i = 1; i < n; ++i) {
+        best = Max ? std::max(best, data[i]) : std::min(best, data[i]);
+    }
+    return best;
+}
+
+#if defined(LINEAR_SCAN_USE_X86)
+
+template <typename T>
+struct Avx2Scan;
+
+template <>
+struct Avx2Scan<int32_t> {
+    using vec = __m256i;
+    static constexpr size_t lanes = 8;
+    LINEAR_SCAN_AVX2 static vec load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    LINEAR_SCAN_AVX2 static vec splat(int32_t x) { return _mm256_set1_epi32(x); }
+    LINEAR_SCAN_AVX2 static uint64_t eq_mask(vec a, vec b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))));
+    }
+    LINEAR_SCAN_AVX2 static vec min(vec a, vec b) { return _mm256_min_epi32(a, b); }
+    LINEAR_SCAN_AVX2 static vec max(vec a, vec b) { return _mm256_max_epi32(a, b); }
+    LINEAR_SCAN_AVX2 static void store(int32_t* p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+template <>
+struct Avx2Scan<int64_t> {
+    using vec = __m256i;
+    static constexpr size_t lanes = 4;
+    LINEAR_SCAN_AVX2 static vec load(const int64_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    LINEAR_SCAN_AVX2 static vec splat(int64_t x) { return _mm256_set1_epi64x(x); }
+    LINEAR_SCAN_AVX2 static uint64_t eq_mask(vec a, vec b) {
+        return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))));
+    }
+    // AVX2 has no 64-bit min/max; select on a signed compare instead
+    LINEAR_SCAN_AVX2 static vec min(vec a, vec b) { return _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)); }
+    LINEAR_SCAN_AVX2 static vec max(vec a, vec b) { return _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)); }
+    LINEAR_SCAN_AVX2 static void store(int64_t* p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+};
+
+template <>
+struct Avx2Scan<float> {
+    using vec = __m256;
+    static constexpr size_t lanes = 8;
+    LINEAR_SCAN_AVX2 static vec load(const float* p) { return _mm256_loadu_ps(p); }
+    LINEAR_SCAN_AVX2 static vec splat(float x) { return _mm256_set1_ps(x); }
+    LINEAR_SCAN_AVX2 static uint64_t eq_mask(vec a, vec b) {
+        return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)));
+    }
+    LINEAR_SCAN_AVX2 static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+    LINEAR_SCAN_AVX2 static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+    LINEAR_SCAN_AVX2 static void store(float* p, vec v) { _mm256_storeu_ps(p, v); }
+};
+
+/**
+ * @brief Lane match mask of four consecutive registers starting at p
+ */
+template <typename T>
+LINEAR_SCAN_AVX2 inline uint64_t avx2_block_mask(const T* p, typename Avx2Scan<T>::vec key) {
+    using Ops = Avx2Scan<T>;
+    constexpr size_t L = Ops::lanes;
+    return Ops::eq_mask(Ops::load(p), key) | Ops::eq_mask(Ops::load(p + L), key) << L |
+           Ops::eq_mask(Ops::load(p + 2 * L), key) << (2 * L) | Ops::eq_mask(Ops::load(p + 3 * L), key) << (3 * L);
+}
+
+template <typename T>
+LINEAR_SCAN_AVX2 size_t avx2_find_first(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx2Scan<T>::lanes;
+    auto key = Avx2Scan<T>::splat(target);
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        uint64_t mask = avx2_block_mask(data + i, key);
+        if (mask) return i + __builtin_ctzll(mask);
+    }
+    size_t rest = scalar_find_first(data + i, n - i, target);
+    return rest == n - i ? n : i + rest;
+}
+
+template <typename T>
+LINEAR_SCAN_AVX2 size_t avx2_find_last(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx2Scan<T>::lanes;
+    auto key = Avx2Scan<T>::splat(target);
+    size_t i = n;
+    for (; i >= step; i -= step) {
+        uint64_t mask = avx2_block_mask(data + i - step, key);
+        if (mask) return i - step + 63 - __builtin_clzll(mask);
+    }
+    size_t rest = scalar_find_last(data, i, target);
+    return rest == i ? n : rest;
+}
+
+template <typename T>
+LINEAR_SCAN_AVX2 size_t avx2_count(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx2Scan<T>::lanes;
+    auto key = Avx2Scan<T>::splat(target);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        count += __builtin_popcountll(avx2_block_mask(data + i, key));
+    }
+    return count + scalar_count(data + i, n - i, target);
+}
+
+template <bool Max, typename T>
+LINEAR_SCAN_AVX2 T avx2_extreme(const T* data, size_t n) {
+    using Ops = Avx2Scan<T>;
+    constexpr size_t L = Ops::lanes;
+    if (n < L) return scalar_extreme<Max>(data, n);
+
+    auto acc = Ops::load(data);
+    size_t i = L;
+    for (; i + L <= n; i += L) {
+        acc = Max ? Ops::max(acc, Ops::load(data + i)) : Ops::min(acc, Ops::load(data + i));
+    }
+    T lanes[L];
+    Ops::store(lanes, acc);
+    T best = scalar_extreme<Max>(lanes, L);
+    if (i < n) {
+        T tail = scalar_extreme<Max>(data + i, n - i);
+        best = Max ? std::max(best, tail) : std::min(best, tail);
+    }
+    return best;
+}
+
+SIMD_AVX512_KERNELS_BEGIN
+
+template <typename T>
+struct Avx512Scan;
+
+template <>
+struct Avx512Scan<int32_t> {
+    using vec = __m512i;
+    static constexpr size_t lanes = 16;
+    LINEAR_SCAN_AVX512 static vec load(const int32_t* p) { return _mm512_loadu_si512(p); }
+    LINEAR_SCAN_AVX512 static vec splat(int32_t x) { return _mm512_set1_epi32(x); }
+    LINEAR_SCAN_AVX512 static uint64_t eq_mask(vec a, vec b) { return _mm512_cmpeq_epi32_mask(a, b); }
+    LINEAR_SCAN_AVX512 static vec min(vec a, vec b) { return _mm512_min_epi32(a, b); }
+    LINEAR_SCAN_AVX512 static vec max(vec a, vec b) { return _mm512_max_epi32(a, b); }
+    LINEAR_SCAN_AVX512 static int32_t reduce_min(vec v) { return _mm512_reduce_min_epi32(v); }
+    LINEAR_SCAN_AVX512 static int32_t reduce_max(vec v) { return _mm512_reduce_max_epi32(v); }
+};
+
+template <>
+struct Avx512Scan<int64_t> {
+    using vec = __m512i;
+    static constexpr size_t lanes = 8;
+    LINEAR_SCAN_AVX512 static vec load(const int64_t* p) { return _mm512_loadu_si512(p); }
+    LINEAR_SCAN_AVX512 static vec splat(int64_t x) { return _mm512_set1_epi64(x); }
+    LINEAR_SCAN_AVX512 static uint64_t eq_mask(vec a, vec b) { return _mm512_cmpeq_epi64_mask(a, b); }
+    LINEAR_SCAN_AVX512 static vec min(vec a, vec b) { return _mm512_min_epi64(a, b); }
+    LINEAR_SCAN_AVX512 static vec max(vec a, vec b) { return _mm512_max_epi64(a, b); }
+    LINEAR_SCAN_AVX512 static int64_t reduce_min(vec v) { return _mm512_reduce_min_epi64(v); }
+    LINEAR_SCAN_AVX512 static int64_t reduce_max(vec v) { return _mm512_reduce_max_epi64(v); }
+};
+
+template <>
+struct Avx512Scan<float> {
+    using vec = __m512;
+    static constexpr size_t lanes = 16;
+    LINEAR_SCAN_AVX512 static vec load(const float* p) { return _mm512_loadu_ps(p); }
+    LINEAR_SCAN_AVX512 static vec splat(float x) { return _mm512_set1_ps(x); }
+    LINEAR_SCAN_AVX512 static uint64_t eq_mask(vec a, vec b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+    LINEAR_SCAN_AVX512 static vec min(vec a, vec b) { return _mm512_min_ps(a, b); }
+    LINEAR_SCAN_AVX512 static vec max(vec a, vec b) { return _mm512_max_ps(a, b); }
+    LINEAR_SCAN_AVX512 static float reduce_min(vec v) { return _mm512_reduce_min_ps(v); }
+    LINEAR_SCAN_AVX512 static float reduce_max(vec v) { return _mm512_reduce_max_ps(v); }
+};
+
+template <typename T>
+LINEAR_SCAN_AVX512 inline uint64_t avx512_block_mask(const T* p, typename Avx512Scan<T>::vec key) {
+    using Ops = Avx512Scan<T>;
+    constexpr size_t L = Ops::lanes;
+    return Ops::eq_mask(Ops::load(p), key) | Ops::eq_mask(Ops::load(p + L), key) << L |
+           Ops::eq_mask(Ops::load(p + 2 * L), key) << (2 * L) | Ops::eq_mask(Ops::load(p + 3 * L), key) << (3 * L);
+}
+
+template <typename T>
+LINEAR_SCAN_AVX512 size_t avx512_find_first(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx512Scan<T>::lanes;
+    auto key = Avx512Scan<T>::splat(target);
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        uint64_t mask = avx512_block_mask(data + i, key);
+        if (mask) return i + __builtin_ctzll(mask);
+    }
+    size_t rest = scalar_find_first(data + i, n - i, target);
+    return rest == n - i ? n : i + rest;
+}
+
+template <typename T>
+LINEAR_SCAN_AVX512 size_t avx512_find_last(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx512Scan<T>::lanes;
+    auto key = Avx512Scan<T>::splat(target);
+    size_t i = n;
+    for (; i >= step; i -= step) {
+        uint64_t mask = avx512_block_mask(data + i - step, key);
+        if (mask) return i - step + 63 - __builtin_clzll(mask);
+    }
+    size_t rest = scalar_find_last(data, i, target);
+    return rest == i ? n : rest;
+}
+
+template <typename T>
+LINEAR_SCAN_AVX512 size_t avx512_count(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * Avx512Scan<T>::lanes;
+    auto key = Avx512Scan<T>::splat(target);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        count += __builtin_popcountll(avx512_block_mask(data + i, key));
+    }
+    return count + scalar_count(data + i, n - i, target);
+}
+
+template <bool Max, typename T>
+LINEAR_SCAN_AVX512 T avx512_extreme(const T* data, size_t n) {
+    using Ops = Avx512Scan<T>;
+    constexpr size_t L = Ops::lanes;
+    if (n < L) return scalar_extreme<Max>(data, n);
+
+    auto acc = Ops::load(data);
+    size_t i = L;
+    for (; i + L <= n; i += L) {
+        acc = Max ? Ops::max(acc, Ops::load(data + i)) : Ops::min(acc, Ops::load(data + i));
+    }
+    T best = Max ? Ops::reduce_max(acc) : Ops::reduce_min(acc);
+    if (i < n) {
+        T tail = scalar_extreme<Max>(data + i, n - i);
+        best = Max ? std::max(best, tail) : std::min(best, tail);
+    }
+    return best;
+}
+
+SIMD_AVX512_KERNELS_END
+
+#endif  // LINEAR_SCAN_USE_X86
+
+#if defined(LINEAR_SCAN_USE_NEON)
+
+template <typename T>
+struct NeonScan;
+
+// NEON has no movemask; AND the all-ones lanes with their bit and add across
+template <>
+struct NeonScan<int32_t> {
+    using vec = int32x4_t;
+    static constexpr size_t lanes = 4;
+    static vec load(const int32_t* p) { return vld1q_s32(p); }
+    static vec splat(int32_t x) { return vdupq_n_s32(x); }
+    static uint64_t eq_mask(vec a, vec b) {
+        static const uint32_t bits[4] = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(vceqq_s32(a, b), vld1q_u32(bits)));
+    }
+    static vec min(vec a, vec b) { return vminq_s32(a, b); }
+    static vec max(vec a, vec b) { return vmaxq_s32(a, b); }
+    static int32_t reduce_min(vec v) { return vminvq_s32(v); }
+    static int32_t reduce_max(vec v) { return vmaxvq_s32(v); }
+};
+
+template <>
+struct NeonScan<int64_t> {
+    using vec = int64x2_t;
+    static constexpr size_t lanes = 2;
+    static vec load(const int64_t* p) { return vld1q_s64(p); }
+    static vec splat(int64_t x) { return vdupq_n_s64(x); }
+    static uint64_t eq_mask(vec a, vec b) {
+        static const uint64_t bits[2] = {1, 2};
+        return vaddvq_u64(vandq_u64(vceqq_s64(a, b), vld1q_u64(bits)));
+    }
+    static vec min(vec a, vec b) { return vbslq_s64(vcgtq_s64(a, b), b, a); }
+    static vec max(vec a, vec b) { return vbslq_s64(vcgtq_s64(a, b), a, b); }
+    static int64_t reduce_min(vec v) { return std::min(vgetq_lane_s64(v, 0), vgetq_lane_s64(v, 1)); }
+    static int64_t reduce_max(vec v) { return std::max(vgetq_lane_s64(v, 0), vgetq_lane_s64(v, 1)); }
+};
+
+template <>
+struct NeonScan<float> {
+    using vec = float32x4_t;
+    static constexpr size_t lanes = 4;
+    static vec load(const float* p) { return vld1q_f32(p); }
+    static vec splat(float x) { return vdupq_n_f32(x); }
+    static uint64_t eq_mask(vec a, vec b) {
+        static const uint32_t bits[4] = {1, 2, 4, 8};
+        return vaddvq_u32(vandq_u32(vceqq_f32(a, b), vld1q_u32(bits)));
+    }
+    static vec min(vec a, vec b) { return vminq_f32(a, b); }
+    static vec max(vec a, vec b) { return vmaxq_f32(a, b); }
+    static float reduce_min(vec v) { return vminvq_f32(v); }
+    static float reduce_max(vec v) { return vmaxvq_f32(v); }
+};
+
+template <typename T>
+inline uint64_t neon_block_mask(const T* p, typename NeonScan<T>::vec key) {
+    using Ops = NeonScan<T>;
+    constexpr size_t L = Ops::lanes;
+    return Ops::eq_mask(Ops::load(p), key) | Ops::eq_mask(Ops::load(p + L), key) << L |
+           Ops::eq_mask(Ops::load(p + 2 * L), key) << (2 * L) | Ops::eq_mask(Ops::load(p + 3 * L), key) << (3 * L);
+}
+
+template <typename T>
+size_t neon_find_first(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * NeonScan<T>::lanes;
+    auto key = NeonScan<T>::splat(target);
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        uint64_t mask = neon_block_mask(data + i, key);
+        if (mask) return i + __builtin_ctzll(mask);
+    }
+    size_t rest = scalar_find_first(data + i, n - i, target);
+    return rest == n - i ? n : i + rest;
+}
+
+template <typename T>
+size_t neon_find_last(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * NeonScan<T>::lanes;
+    auto key = NeonScan<T>::splat(target);
+    size_t i = n;
+    for (; i >= step; i -= step) {
+        uint64_t mask = neon_block_mask(data + i - step, key);
+        if (mask) return i - step + 63 - __builtin_clzll(mask);
+    }
+    size_t rest = scalar_find_last(data, i, target);
+    return rest == i ? n : rest;
+}
+
+template <typename T>
+size_t neon_count(const T* data, size_t n, T target) {
+    constexpr size_t step = 4 * NeonScan<T>::lanes;
+    auto key = NeonScan<T>::splat(target);
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + step <= n; i += step) {
+        count += __builtin_popcountll(neon_block_mask(data + i, key));
+    }
+    return count + scalar_count(data + i, n - i, target);
+}
+
+template <bool Max, typename T>
+T neon_extreme(const T* data, size_t n) {
+    using Ops = NeonScan<T>;
+    constexpr size_t L = Ops::lanes;
+    if (n < L) return scalar_extreme<Max>(data, n);
+
+    auto acc = Ops::load(data);
+    size_t i = L;
+    for (; i + L <= n; i += L) {
+        acc = Max ? Ops::max(acc, Ops::load(data + i)) : Ops::min(acc, Ops::load(data + i));
+    }
+    T best = Max ? Ops::reduce_max(acc) : Ops::reduce_min(acc);
+    if (i < n) {
+        T tail = scalar_extreme<Max>(data + i, n - i);
+        best = Max ? std::max(best, tail) : std::min(best, tail);
+    }
+    return best;
+}
+
+#endif  // LINEAR_SCAN_USE_NEON
+
+/**
+ * @brief Index of the first element equal to target in data[0..n), n if none
+ */
+template <typename T>
+size_t find_first(const T* data, size_t n, T target) {
+    switch (active_simd_level()) {
+#if defined(LINEAR_SCAN_USE_X86)
+        case SimdLevel::Avx512: return avx512_find_first(data, n, target);
+        case SimdLevel::Avx2: return avx2_find_first(data, n, target);
+#endif
+#if defined(LINEAR_SCAN_USE_NEON)
+        case SimdLevel::Neon: return neon_find_first(data, n, target);
+#endif
+        default: return scalar_find_first(data, n, target);
+    }
+}
+
+/**
+ * @brief Index of the last element equal to target in data[0..n), n if none
+ */
+template <typename T>
+size_t find_last(const T* data, size_t n, T target) {
+    switch (active_simd_level()) {
+#if defined(LINEAR_SCAN_USE_X86)
+        case SimdLevel::Avx512: return avx512_find_last(data, n, target);
+        case SimdLevel::Avx2: return avx2_find_last(data, n, target);
+#endif
+#if defined(LINEAR_SCAN_USE_NEON)
+        case SimdLevel::Neon: return neon_find_last(data, n, target);
+#endif
+        default: return scalar_find_last(data, n, target);
+    }
+}
+
+template <typename T>
+size_t count(const T* data, size_t n, T target) {
+    switch (active_simd_level()) {
+#if defined(LINEAR_SCAN_USE_X86)
+        case SimdLevel::Avx512: return avx512_count(data, n, target);
+        case SimdLevel::Avx2: return avx2_count(data, n, target);
+#endif
+#if defined(LINEAR_SCAN_USE_NEON)
+        case SimdLevel::Neon: return neon_count(data, n, target);
+#endif
+        default: return scalar_count(data, n, target);
+    }
+}
+
+/**
+ * @brief Smallest (or largest, for Max) value of data[0..n), n > 0
+ */
+template <bool Max, typename T>
+T extreme(const T* data, size_t n) {
+    switch (active_simd_level()) {
+#if defined(LINEAR_SCAN_USE_X86)
+        case SimdLevel::Avx512: return avx512_extreme<Max>(data, n);
+        case SimdLevel::Avx2: return avx2_extreme<Max>(data, n);
+#endif
+#if defined(LINEAR_SCAN_USE_NEON)
+        case SimdLevel::Neon: return neon_extreme<Max>(data, n);
+#endif
+        default: return scalar_extreme<Max>(data, n);
+    }
+}
+
+/**
+ * @brief First index of the minimum (or maximum) of data[0..n), n > 0
+ *
+ * Vector min/max loses the lane position, so the scan runs block by block
+ * and only looks for the index in blocks that beat the best value so far.
+ */
+template <bool Max, typename T>
+size_t extreme_index(const T* data, size_t n) {
+    T best = data[0];
+    size_t best_index = 0;
+    for (size_t begin = 0; begin < n; begin += extreme_block) {
+        size_t len = std::min(extreme_block, n - begin);
+        T value = extreme<Max>(data + begin, len);
+        if (Max ? best < value : value < best) {
+            best = value;
+            best_index = begin + find_first(data + begin, len, value);
+        }
+    }
+    return best_index;
+}
+
+unsigned scan_thread_count(size_t n, const ScanOptions& options) {
+    if (n < options.parallel_threshold) return 1;
+    unsigned threads = options.threads == 0 ? std::thread::hardware_concurrency() : options.threads;
+    return std::max(1u, threads);
+}
+
+/**
+ * @brief Call body(t, begin, end) for contiguous chunk t of [0, n), one chunk per thread
+ */
+template <typename Body>
+void for_each_chunk(size_t n, unsigned threads, Body body) {
+    size_t chunk = (n + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) {
+        size_t begin = std::min(n, t * chunk);
+        size_t end = std::min(n, begin + chunk);
+        workers.emplace_back([=, &body] { body(t, begin, end); });
+    }
+    body(0u, size_t(0), std::min(n, chunk));
+    for (auto& worker : workers) worker.join();
+}
+
+template <typename T>
+size_t parallel_find_first(const T* data, size_t n, T target, unsigned threads) {
+    std::atomic<size_t> best(n);
+    for_each_chunk(n, threads, [&](unsigned, size_t begin, size_t end) {
+        for (size_t pos = begin; pos < end; pos += parallel_step) {
+            if (best.load(std::memory_order_relaxed) < pos) return;  // An earlier chunk already matched
+            size_t len = std::min(parallel_step, end - pos);
+            size_t hit = find_first(data + pos, len, target);
+            if (hit != len) {
+                size_t index = pos + hit;
+                size_t current = best.load(std::memory_order_relaxed);
+                while (index < current && !best.compare_exchange_weak(current, index)) {}
+                return;
+            }
+        }
+    });
+    return best.load();
+}
+
+template <typename T>
+size_t parallel_find_last(const T* data, size_t n, T target, unsigned threads) {
+    // Stored as index + 1 so that 0 means "not found"
+    std::atomic<size_t> best(0);
+    for_each_chunk(n, threads, [&](unsigned, size_t begin, size_t end) {
+        for (size_t pos = end; pos > begin;) {
+            if (best.load(std::memory_order_relaxed) > pos) return;  // A later chunk already matched
+            size_t len = std::min(parallel_step, pos - begin);
+            pos -= len;
+            size_t hit = find_last(data + pos, len, target);
+            if (hit != len) {
+                size_t index = pos + hit + 1;
+                size_t current = best.load(std::memory_order_relaxed);
+                while (index > current && !best.compare_exchange_weak(current, index)) {}
+                return;
+            }
+        }
+    });
+    size_t found = best.load();
+    return found == 0 ? n : found - 1;
+}
+
+template <typename T>
+size_t parallel_count(const T* data, size_t n, T target, unsigned threads) {
+    std::vector<size_t> partial(threads, 0);
+    for_each_chunk(n, threads, [&](unsigned t, size_t begin, size_t end) {
+        partial[t] = count(data + begin, end - begin, target);
+    });
+    size_t total = 0;
+    for (size_t c : partial) total += c;
+    return total;
+}
+
+template <bool Max, typename T>
+size_t parallel_extreme_index(const T* data, size_t n, unsigned threads) {
+    std::vector<size_t> partial(threads, n);
+    for_each_chunk(n, threads, [&](unsigned t, size_t begin, size_t end) {
+        if (begin < end) partial[t] = begin + extreme_index<Max>(data + begin, end - begin);
+    });
+    // Chunks are in order, so a strict comparison keeps the first index on ties
+    size_t best = partial[0];
+    for (unsigned t = 1; t < threads; ++t) {
+        size_t i = partial[t];
+        if (i != n && (Max ? data[best] < data[i] : data[i] < data[best])) best = i;
+    }
+    return best;
+}
+
+template <typename T>
+void check_scan_input(const std::vector<T>& arr) {
+    static_assert(is_scan_type<T>::value, "SIMD scans support int32_t, int64_t and float");
+    if (arr.size() > static_cast<size_t>(INT_MAX)) {
+        throw std::length_error("SIMD scans return int indices; array is too large");
+    }
+}
+
+} // namespace scan_detail
+
+/**
+ * @brief Vectorized linear_search_basic
+ * @param arr Array to search in (int32_t, int64_t or float)
+ * @param target Value to search for
+ * @param options Threading for large arrays
+ * @return Index of the first occurrence of target, -1 if not found
+ */
+template <typename T>
+int linear_search_simd(const std::vector<T>& arr, typename std::vector<T>::value_type target,
+                       const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    size_t n = arr.size();
+    unsigned threads = scan_detail::scan_thread_count(n, options);
+    size_t i = threads > 1 ? scan_detail::parallel_find_first(arr.data(), n, target, threads)
+                           : scan_detail::find_first(arr.data(), n, target);
+    return i == n ? -1 : static_cast<int>(i);
+}
+
+/**
+ * @brief Vectorized linear_search_reverse
+ * @return Index of the last occurrence of target, -1 if not found
+ */
+template <typename T>
+int linear_search_reverse_simd(const std::vector<T>& arr, typename std::vector<T>::value_type target,
+                               const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    size_t n = arr.size();
+    unsigned threads = scan_detail::scan_thread_count(n, options);
+    size_t i = threads > 1 ? scan_detail::parallel_find_last(arr.data(), n, target, threads)
+                           : scan_detail::find_last(arr.data(), n, target);
+    return i == n ? -1 : static_cast<int>(i);
+}
+
+/**
+ * @brief Vectorized linear_search_all
+ * @return Indices of all occurrences of target, in increasing order
+ */
+template <typename T>
+std::vector<int> linear_search_all_simd(const std::vector<T>& arr, typename std::vector<T>::value_type target,
+                                        const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    size_t n = arr.size();
+    unsigned threads = scan_detail::scan_thread_count(n, options);
+
+    std::vector<std::vector<int>> partial(threads);
+    scan_detail::for_each_chunk(n, threads, [&](unsigned t, size_t begin, size_t end) {
+        // Each find restarts just past the previous match
+        for (size_t pos = begin; pos < end;) {
+            size_t hit = scan_detail::find_first(arr.data() + pos, end - pos, target);
+            if (hit == end - pos) break;
+            partial[t].push_back(static_cast<int>(pos + hit));
+            pos += hit + 1;
+        }
+    });
+
+    if (threads == 1) return std::move(partial[0]);
+    std::vector<int> indices;
+    for (const auto& p : partial) indices.insert(indices.end(), p.begin(), p.end());
+    return indices;
+}
+
+/**
+ * @brief Vectorized count_occurrences
+ * @return Number of elements equal to target
+ */
+template <typename T>
+int count_occurrences_simd(const std::vector<T>& arr, typename std::vector<T>::value_type target,
+                           const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    size_t n = arr.size();
+    unsigned threads = scan_detail::scan_thread_count(n, options);
+    size_t c = threads > 1 ? scan_detail::parallel_count(arr.data(), n, target, threads)
+                           : scan_detail::count(arr.data(), n, target);
+    return static_cast<int>(c);
+}
+
+/**
+ * @brief Vectorized find_minimum_linear
+ * @return Index of the first minimum element, -1 if arr is empty
+ */
+template <typename T>
+int find_minimum_simd(const std::vector<T>& arr, const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    if (arr.empty()) return -1;
+    unsigned threads = scan_detail::scan_thread_count(arr.size(), options);
+    size_t i = threads > 1 ? scan_detail::parallel_extreme_index<false>(arr.data(), arr.size(), threads)
+                           : scan_detail::extreme_index<false>(arr.data(), arr.size());
+    return static_cast<int>(i);
+}
+
+/**
+ * @brief Vectorized find_maximum_linear
+ * @return Index of the first maximum element, -1 if arr is empty
+ */
+template <typename T>
+int find_maximum_simd(const std::vector<T>& arr, const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    if (arr.empty()) return -1;
+    unsigned threads = scan_detail::scan_thread_count(arr.size(), options);
+    size_t i = threads > 1 ? scan_detail::parallel_extreme_index<true>(arr.data(), arr.size(), threads)
+                           : scan_detail::extreme_index<true>(arr.data(), arr.size());
+    return static_cast<int>(i);
+}
+
+/**
+ * @brief Vectorized linear_search_bidirectional
+ *
+ * Scans one block from the front, then one from the back, moving inward,
+ * so a target near either end is found after touching only a few blocks.
+ * Large arrays use the parallel front-to-back search instead.
+ *
+ * @return Index of an occurrence of target, -1 if not found
+ */
+template <typename T>
+int linear_search_bidirectional_simd(const std::vector<T>& arr, typename std::vector<T>::value_type target,
+                                     const ScanOptions& options = ScanOptions()) {
+    scan_detail::check_scan_input(arr);
+    size_t n = arr.size();
+    if (scan_detail::scan_thread_count(n, options) > 1) {
+        return linear_search_simd(arr, target, options);
+    }
+
+    constexpr size_t block = 1024;
+    const T* data = arr.data();
+    size_t left = 0, right = n;
+    while (left < right) {
+        size_t len = std::min(block, right - left);
+        size_t hit = scan_detail::find_first(data + left, len, target);
+        if (hit != len) return static_cast<int>(left + hit);
+        left += len;
+
+        len = std::min(block, right - left);
+        hit = scan_detail::find_last(data + right - len, len, target);
+        if (hit != len) return static_cast<int>(right - len + hit);
+        right -= len;
+    }
+    return -1;
+}
+
+/**
+ * @brief Check every SIMD scan against a scalar loop at every SimdLevel
+ */
+void test_simd_linear_search() {
+    std::cout << "\n=== Testing SIMD Linear Search ===" << std::endl;
+
+    SimdLevel original = active_simd_level();
+    bool all_ok = true;
+    std::mt19937 rng(5);
+
+    auto check_type = [&](auto tag) {
+        using T = decltype(tag);
+        for (size_t n : {0, 1, 7, 33, 64, 65, 1000, 5000, 100003}) {
+            std::vector<T> arr(n);
+            for (auto& x : arr) x = static_cast<T>(rng() % 200) - 100;
+
+            ScanOptions serial;
+            ScanOptions parallel;
+            parallel.parallel_threshold = 1;
+            parallel.threads = 4;
+
+            for (const ScanOptions& options : {serial, parallel}) {
+                for (T target : {T(-100), T(0), T(57), T(1000)}) {
+                    auto first = std::find(arr.begin(), arr.end(), target);
+                    int expected_first = first == arr.end() ? -1 : static_cast<int>(first - arr.begin());
+                    auto last = std::find(arr.rbegin(), arr.rend(), target);
+                    int expected_last = last == arr.rend() ? -1 : static_cast<int>(arr.rend() - last - 1);
+                    std::vector<int> expected_all;
+                    for (size_t i = 0; i < n; ++i) {
+                        if (arr[i] == target) expected_all.push_back(static_cast<int>(i));
+                    }
+
+                    int bidir = linear_search_bidirectional_simd(arr, target, options);
+                    all_ok = all_ok && linear_search_simd(arr, target, options) == expected_first &&
+                             linear_search_reverse_simd(arr, target, options) == expected_last &&
+                             linear_search_all_simd(arr, target, options) == expected_all &&
+                             count_occurrences_simd(arr, target, options) == static_cast<int>(expected_all.size()) &&
+                             (bidir == -1 ? expected_first == -1 : arr[bidir] == target);
+                }
+
+                int expected_min = arr.empty() ? -1 : static_cast<int>(std::min_element(arr.begin(), arr.end()) - arr.begin());
+                int expected_max = arr.empty() ? -1 : static_cast<int>(std::max_element(arr.begin(), arr.end()) - arr.begin());
+                all_ok = all_ok && find_minimum_simd(arr, options) == expected_min &&
+                         find_maximum_simd(arr, options) == expected_max;
+            }
+        }
+    };
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        set_simd_level(level);
+        if (active_simd_level() != level) continue;  // Not available on this CPU
+        check_type(int32_t());
+        check_type(int64_t());
+        check_type(float());
+        std::cout << simd_level_name(level) << ": " << (all_ok ? "ok" : "FAILED") << std::endl;
+    }
+    set_simd_level(original);
+
+    std::cout << (all_ok ? "All scans match the scalar versions" : "FAILED") << std::endl;
+}
+
+/**
+ * @brief Scan throughput of the scalar loop, each SimdLevel and the parallel mode
+ * @param n Number of int32 elements (the default is a 1 GB column)
+ */
+void compare_simd_linear_search(size_t n = size_t(1) << 28) {
+    std::cout << "\n=== SIMD Linear Search (" << n << " int32, " << (n * 4 >> 20) << " MB) ===" << std::endl;
+
+    std::vector<int32_t> arr(n);
+    for (size_t i = 0; i < n; ++i) arr[i] = static_cast<int32_t>(i % 1000003);
+    int32_t missing = -1;  // Forces a full scan
+
+    auto report = [&](const char* name, auto&& scan) {
+        auto start = std::chrono::high_resolution_clock::now();
+        long long result = scan();
+        auto end = std::chrono::high_resolution_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        std::cout << name << ": " << seconds * 1000 << " ms, " << (n * sizeof(int32_t)) / seconds / 1e9
+                  << " GB/s (result " << result << ")" << std::endl;
+    };
+
+    // Same loop as linear_search_basic
+    report("scalar find       ", [&] {
+        for (size_t i = 0; i < n; ++i) {
+            if (arr[i] == missing) return static_cast<long long>(i);
+        }
+        return -1LL;
+    });
+
+    SimdLevel original = active_simd_level();
+    ScanOptions serial;
+    serial.parallel_threshold = SIZE_MAX;
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Neon, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        set_simd_level(level);
+        if (active_simd_level() != level) continue;
+        std::cout << simd_level_name(level) << ":" << std::endl;
+        report("  find            ", [&] { return linear_search_simd(arr, missing, serial); });
+        report("  count           ", [&] { return count_occurrences_simd(arr, 7, serial); });
+        report("  minimum         ", [&] { return find_minimum_simd(arr, serial); });
+    }
+    set_simd_level(original);
+
+    std::cout << "parallel (" << std::max(1u, std::thread::hardware_concurrency()) << " threads, "
+              << simd_level_name(original) << "):" << std::endl;
+    report("  find            ", [&] { return linear_search_simd(arr, missing); });
+    report("  count           ", [&] { return count_occurrences_simd(arr, 7); });
+    report("  minimum         ", [&] { return find_minimum_simd(arr); });
+}
@@ -0,0 +1,492 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include "05-Static Search Index.cpp"  // StaticSearchIndex over the segment keys
+
+/**
+ * @brief Learned Index (piecewise-linear position model with bounded error)
+ *
+ * Interpolation search guesses a key's position from one straight line
+ * through arr[low] and arr[high]. On real keys (timestamps with bursts,
+ * IDs with gaps) the key-to-position curve is far from straight, and the
+ * guesses degrade toward a linear walk. A learned index instead fits the
+ * curve with many short lines:
+ *
+ * - Build: one pass over the sorted keys cuts them into segments. Each
+ *   segment is a line through its first key whose prediction is within
+ *   epsilon positions of every key it covers ("shrinking cone": the range
+ *   of slopes that keeps all points so far within epsilon narrows with
+ *   each key, and a new segment starts when it becomes empty). The actual
+ *   maximum error of each segment is stored.
+ * - Lookup: find the segment (a StaticSearchIndex over the segment keys,
+ *   which is small enough to stay in cache), evaluate its line and run a
+ *   binary search over the few positions the stored error allows.
+ *
+ * epsilon trades memory for lookup cost: halving it roughly doubles the
+ * number of segments and halves the final search window. A byte budget can
+ * be set instead, and epsilon is raised until the model fits.
+ *
+ * The index stores only the model; lookups read the original vector,
+ * which must outlive the index and stay unchanged.
+ *
+ * Time Complexity:
+ * - Build: O(n)
+ * - Query: O(log segments + log epsilon)
+ *
+ * Space Complexity: O(segments), about 24 bytes per segment plus the
+ * segment key index
+ */
+
+/**
+ * @brief Build parameters for LearnedIndex
+ */
+struct LearnedIndexConfig {
+    size_t epsilon = 32;          // Max position error per segment
+    size_t max_model_bytes = 0;   // 0 = no limit; otherwise epsilon grows until the model fits
+};
+
+/**
+ * @brief Error statistics of a built LearnedIndex
+ */
+struct LearnedIndexStats {
+    size_t keys = 0;
+    size_t segments = 0;
+    size_t epsilon = 0;             // Bound the segments were fitted to
+    size_t max_error = 0;           // Largest |predicted - actual| position over all keys
+    double mean_error = 0.0;        // Average |predicted - actual| position
+    double mean_window = 0.0;       // Average positions examined by the final search
+    size_t model_bytes = 0;
+};
+
+/**
+ * @brief Piecewise-linear learned index over a sorted vector
+ * @tparam T Arithmetic key type (keys are converted to double for the model)
+ */
+template <typename T>
+class LearnedIndex {
+    static_assert(std::is_arithmetic<T>::value, "LearnedIndex needs arithmetic keys");
+
+public:
+    /**
+     * @brief Fit the model to a sorted vector
+     * @param sorted Keys in ascending order (duplicates allowed); must outlive the index
+     * @param config Error bound and memory budget
+     * @throws std::invalid_argument if sorted is not sorted or epsilon is 0
+     * @throws std::length_error if there are more keys than an int can index
+     */
+    explicit LearnedIndex(const std::vector<T>& sorted, const LearnedIndexConfig& config = LearnedIndexConfig())
+        : data(&sorted) {
+        if (sorted.size() > static_cast<size_t>(INT_MAX)) {
+            throw std::length_error("LearnedIndex supports at most INT_MAX keys");
+        }
+        if (config.epsilon == 0) {
+            throw std::invalid_argument("LearnedIndex epsilon must be positive");
+        }
+        if (!std::is_sorted(sorted.begin(), sorted.end())) {
+            throw std::invalid_argument("LearnedIndex input must be sorted");
+        }
+
+        epsilon = config.epsilon;
+        fit();
+        while (config.max_model_bytes != 0 && model_bytes() > config.max_model_bytes && epsilon < sorted.size()) {
+            epsilon *= 2;
+            fit();
+        }
+    }
+
+    /**
+     * @brief Index of the first key >= target (size() if none), like std::lower_bound
+     */
+    int lower_bound(const T& target) const {
+        const std::vector<T>& arr = *data;
+        size_t n = arr.size();
+        if (n == 0 || !(arr[0] < target)) return 0;
+
+        // Last segment whose first key is <= target
+        size_t s = static_cast<size_t>(segment_index.floor(target));
+        const Segment& seg = segments[s];
+        size_t begin = seg.rank;
+        size_t end = s + 1 < segments.size() ? segments[s + 1].rank : n;
+
+        size_t pred = predict(seg, target, begin, end);
+        size_t lo = pred > begin + seg.error ? pred - seg.error : begin;
+        size_t hi = std::min(end, pred + seg.error + 2);
+
+        size_t pos = std::lower_bound(arr.begin() + lo, arr.begin() + hi, target) - arr.begin();
+        if (pos == hi && hi < end) {
+            // target falls after a run of duplicates the line skipped over
+            pos = gallop_lower_bound(hi, end, target);
+        }
+        return static_cast<int>(pos);
+    }
+
+    /**
+     * @brief Index of the first key > target (size() if none), like std::upper_bound
+     */
+    int upper_bound_index(const T& target) const {
+        size_t pos = static_cast<size_t>(lower_bound(target));
+        const std::vector<T>& arr = *data;
+        if (pos == arr.size() || target < arr[pos]) return static_cast<int>(pos);
+
+        // Skip the run of keys equal to target by galloping
+        size_t step = 1;
+        size_t low = pos;
+        while (low + step < arr.size() && !(target < arr[low + step])) {
+            low += step;
+            step *= 2;
+        }
+        size_t high = std::min(arr.size(), low + step);
+        return static_cast<int>(std::upper_bound(arr.begin() + low, arr.begin() + high, target) - arr.begin());
+    }
+
+    /**
+     * @brief Index of the first occurrence of target, -1 if not found
+     */
+    int find(const T& target) const {
+        int pos = lower_bound(target);
+        const std::vector<T>& arr = *data;
+        return (pos < static_cast<int>(arr.size()) && !(target < arr[pos])) ? pos : -1;
+    }
+
+    bool contains(const T& target) const { return find(target) != -1; }
+
+    /**
+     * @brief Smallest key >= target, same result as binary_search_ceiling
+     */
+    int ceiling(const T& target) const {
+        int pos = lower_bound(target);
+        return pos == static_cast<int>(data->size()) ? -1 : pos;
+    }
+
+    /**
+     * @brief Largest key <= target, same result as binary_search_floor
+     */
+    int floor(const T& target) const {
+        return upper_bound_index(target) - 1;
+    }
+
+    int count(const T& target) const {
+        return upper_bound_index(target) - lower_bound(target);
+    }
+
+    size_t size() const { return data->size(); }
+    size_t segment_count() const { return segments.size(); }
+
+    /**
+     * @brief Bytes used by the model (segments and the segment key index)
+     */
+    size_t model_bytes() const {
+        return segments.capacity() * sizeof(Segment) + segment_keys.capacity() * sizeof(T) +
+               segment_index.memory_bytes();
+    }
+
+    /**
+     * @brief Measure how well the model predicts the positions of its own keys
+     */
+    LearnedIndexStats stats() const {
+        LearnedIndexStats result;
+        const std::vector<T>& arr = *data;
+        result.keys = arr.size();
+        result.segments = segments.size();
+        result.epsilon = epsilon;
+        result.model_bytes = model_bytes();
+
+        double total_error = 0.0;
+        double total_window = 0.0;
+        size_t measured = 0;
+        for (size_t s = 0; s < segments.size(); ++s) {
+            const Segment& seg = segments[s];
+            size_t begin = seg.rank;
+            size_t end = s + 1 < segments.size() ? segments[s + 1].rank : arr.size();
+            for (size_t i = begin; i < end; ++i) {
+                if (i > begin && !(arr[i - 1] < arr[i])) continue;  // Duplicates share the first rank
+                size_t pred = predict(seg, arr[i], begin, end);
+                size_t error = pred > i ? pred - i : i - pred;
+                result.max_error = std::max(result.max_error, error);
+                total_error += static_cast<double>(error);
+                size_t lo = pred > begin + seg.error ? pred - seg.error : begin;
+                total_window += static_cast<double>(std::min(end, pred + seg.error + 2) - lo);
+                ++measured;
+            }
+        }
+        if (measured > 0) {
+            result.mean_error = total_error / measured;
+            result.mean_window = total_window / measured;
+        }
+        return result;
+    }
+
+private:
+    struct Segment {
+        double key;     // First key of the segment, as the line's origin
+        double slope;   // Positions per unit of key
+        int rank;       // Position of the first key
+        int error;      // Largest position error of any key in the segment
+    };
+
+    const std::vector<T>* data;
+    size_t epsilon = 0;
+    std::vector<Segment> segments;
+    std::vector<T> segment_keys;
+    StaticSearchIndex<T> segment_index{std::vector<T>()};
+
+    /**
+     * @brief Predicted position of key within segment [begin, end)
+     */
+    static size_t predict(const Segment& seg, const T& key, size_t begin, size_t end) {
+        double offset = seg.slope * (static_cast<double>(key) - seg.key);
+        double pos = static_cast<double>(seg.rank) + offset;
+        if (!(pos > static_cast<double>(begin))) return begin;  // Also catches NaN
+        if (pos >= static_cast<double>(end)) return end - 1;
+        // Round before clamping: a pos in [end - 0.5, end) must not round up to end,
+        // or predictions stop being monotone in key
+        return std::min(static_cast<size_t>(pos + 0.5), end - 1);
+    }
+
+    size_t gallop_lower_bound(size_t from, size_t end, const T& target) const {
+        const std::vector<T>& arr = *data;
+        size_t step = 1;
+        size_t low = from;
+        while (low + step < end && arr[low + step - 1] < target) {
+            low += step;
+            step *= 2;
+        }
+        size_t high = std::min(end, low + step);
+        return std::lower_bound(arr.begin() + low, arr.begin() + high, target) - arr.begin();
+    }
+
+    /**
+     * @brief Cut the keys into segments with error <= epsilon (shrinking cone)
+     *
+     * Points are (key, position of its first occurrence). Every segment's
+     * line passes through its first point, so only the slope is free: each
+     * later point allows slopes in [(y - eps - y0) / dx, (y + eps - y0) / dx],
+     * and the segment ends when the intersection of those ranges is empty.
+     */
+    void fit() {
+        const std::vector<T>& arr = *data;
+        segments.clear();
+        segment_keys.clear();
+        segment_index = StaticSearchIndex<T>(segment_keys);
+        if (arr.empty()) return;
+
+        const double eps = static_cast<double>(epsilon);
+        size_t start = 0;
+        double slope_lo = 0.0, slope_hi = INFINITY;
+        std::vector<size_t> points;  // First positions of distinct keys in the open segment
+
+        auto close_segment = [&](size_t end) {
+            Segment seg;
+            seg.key = static_cast<double>(arr[start]);
+            seg.rank = static_cast<int>(start);
+            if (slope_hi == INFINITY) {
+                seg.slope = slope_lo;  // One distinct key: any slope is exact
+            } else {
+                seg.slope = (slope_lo + slope_hi) / 2;
+            }
+            size_t max_error = 0;
+            for (size_t p : points) {
+                size_t pred = predict(seg, arr[p], start, end);
+                max_error = std::max(max_error, pred > p ? pred - p : p - pred);
+            }
+            seg.error = static_cast<int>(max_error);
+            segments.push_back(seg);
+            segment_keys.push_back(arr[start]);
+        };
+
+        points.push_back(0);
+        for (size_t i = 1; i < arr.size(); ++i) {
+            if (!(arr[i - 1] < arr[i])) continue;  // Same key as before
+
+            double dx = static_cast<double>(arr[i]) - static_cast<double>(arr[start]);
+            double dy = static_cast<double>(i - start);
+            double lo = (dy - eps) / dx;
+            double hi = (dy + eps) / dx;
+            double new_lo = std::max(slope_lo, lo);
+            double new_hi = std::min(slope_hi, hi);
+
+            if (dx > 0 && new_lo <= new_hi) {
+                slope_lo = new_lo;
+                slope_hi = new_hi;
+                points.push_back(i);
+            } else {
+                close_segment(i);
+                start = i;
+                slope_lo = 0.0;
+                slope_hi = INFINITY;
+                points.assign(1, i);
+            }
+        }
+        close_segment(arr.size());
+
+        segments.shrink_to_fit();
+        segment_keys.shrink_to_fit();
+        segment_index = StaticSearchIndex<T>(segment_keys);
+    }
+};
+
+/**
+ * @brief Print the error statistics of a LearnedIndex
+ */
+template <typename T>
+void print_learned_index_stats(const LearnedIndex<T>& index, const std::string& label = "") {
+    LearnedIndexStats s = index.stats();
+    if (!label.empty()) std::cout << label << ": ";
+    std::cout << s.segments << " segments for " << s.keys << " keys (epsilon " << s.epsilon
+              << "), error mean " << s.mean_error << " max " << s.max_error
+              << ", window mean " << s.mean_window << ", model " << s.model_bytes / 1024 << " KB" << std::endl;
+}
+
+/**
+ * @brief Skewed sorted keys: exponential gaps with occasional bursts and holes
+ */
+std::vector<int64_t> make_skewed_keys(size_t n, unsigned seed = 1) {
+    std::mt19937_64 rng(seed);
+    std::exponential_distribution<double> gap(1.0 / 50.0);
+    std::vector<int64_t> keys(n);
+    int64_t key = 1600000000000LL;  // Millisecond timestamps
+    for (size_t i = 0; i < n; ++i) {
+        if (rng() % 1000 == 0) key += static_cast<int64_t>(rng() % 100000000);  // Outage
+        bool burst = (i / 10000) % 7 == 0;
+        key += burst ? static_cast<int64_t>(rng() % 3) : static_cast<int64_t>(gap(rng));
+        keys[i] = key;
+    }
+    return keys;
+}
+
+/**
+ * @brief Check lookups against std::lower_bound/upper_bound
+ */
+void test_learned_index() {
+    std::cout << "\n=== Testing LearnedIndex ===" << std::endl;
+
+    bool all_ok = true;
+    std::mt19937 rng(9);
+
+    auto check = [&](const std::vector<int64_t>& keys, const LearnedIndexConfig& config) {
+        LearnedIndex<int64_t> index(keys, config);
+        for (int q = 0; q < 20000; ++q) {
+            int64_t target;
+            if (keys.empty() || q % 4 == 0) {
+                target = static_cast<int64_t>(rng());
+            } else if (q % 4 == 3 && keys.size() > 1) {
+                // Absent target between two neighbouring keys, which lands near segment ends
+                size_t i = rng() % (keys.size() - 1);
+                target = keys[i] + (keys[i + 1] - keys[i]) / 2;
+            } else {
+                target = keys[rng() % keys.size()] + static_cast<int64_t>(q % 4 == 1 ? 0 : 1);
+            }
+            int lb = static_cast<int>(std::lower_bound(keys.begin(), keys.end(), target) - keys.begin());
+            int ub = static_cast<int>(std::upper_bound(keys.begin(), keys.end(), target) - keys.begin());
+            if (index.lower_bound(target) != lb || index.upper_bound_index(target) != ub ||
+                index.find(target) != (lb < ub ? lb : -1)) {
+                all_ok = false;
+                return;
+            }
+        }
+        LearnedIndexStats s = index.stats();
+        all_ok = all_ok && s.max_error <= s.epsilon;
+    };
+
+    check({}, LearnedIndexConfig());
+    check({42}, LearnedIndexConfig());
+    check(std::vector<int64_t>(1000, 7), LearnedIndexConfig());  // One key repeated
+
+    std::vector<int64_t> dups;
+    for (int i = 0; i < 50000; ++i) dups.push_back(i / (1 + i % 97));
+    std::sort(dups.begin(), dups.end());
+    check(dups, LearnedIndexConfig());
+
+    // Few keys spread over the whole int64 range: wide gaps push predictions to segment ends
+    std::mt19937_64 wide_rng(24);
+    for (int trial = 0; trial < 300; ++trial) {
+        std::vector<int64_t> wide(2 + wide_rng() % 40);
+        for (auto& key : wide) key = static_cast<int64_t>(wide_rng() >> 1);
+        std::sort(wide.begin(), wide.end());
+        LearnedIndexConfig config;
+        config.epsilon = 1 + wide_rng() % 100;
+        check(wide, config);
+    }
+
+    std::vector<int64_t> skewed = make_skewed_keys(200000);
+    for (size_t eps : {1, 4, 64, 1024}) {
+        LearnedIndexConfig config;
+        config.epsilon = eps;
+        check(skewed, config);
+    }
+
+    LearnedIndexConfig budget;
+    budget.epsilon = 2;
+    budget.max_model_bytes = 16 * 1024;
+    LearnedIndex<int64_t> small(skewed, budget);
+    print_learned_index_stats(small, "16 KB budget");
+    all_ok = all_ok && small.model_bytes() <= budget.max_model_bytes;
+
+    std::cout << (all_ok ? "All lookups match std::lower_bound/upper_bound" : "FAILED") << std::endl;
+}
+
+/**
+ * @brief Lookup time on skewed keys: interpolation, binary, Eytzinger and learned
+ * @param n Number of keys
+ * @param queries Number of random lookups of existing keys
+ */
+void compare_learned_index(size_t n = 10000000, size_t queries = 2000000) {
+    std::cout << "\n=== LearnedIndex on skewed keys (" << n << " keys, " << queries << " lookups) ===" << std::endl;
+
+    std::vector<int64_t> keys = make_skewed_keys(n);
+    std::mt19937 rng(4);
+    std::vector<int64_t> targets(queries);
+    for (auto& t : targets) t = keys[rng() % n];
+
+    auto time_queries = [&](const char* name, auto&& query) {
+        long long checksum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int64_t t : targets) checksum += query(t);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << name << ": " << std::chrono::duration<double, std::nano>(end - start).count() / queries
+                  << " ns/lookup (checksum " << checksum << ")" << std::endl;
+    };
+
+    // One global line, refitted on the remaining range each step (as in interpolation_search_safe)
+    long long probes = 0;
+    time_queries("interpolation       ", [&](int64_t t) {
+        size_t low = 0, high = n - 1;
+        while (low <= high && t >= keys[low] && t <= keys[high]) {
+            ++probes;
+            if (keys[high] == keys[low]) return keys[low] == t ? static_cast<long long>(low) : -1LL;
+            double fraction = static_cast<double>(t - keys[low]) / static_cast<double>(keys[high] - keys[low]);
+            size_t pos = low + static_cast<size_t>(fraction * static_cast<double>(high - low));
+            if (keys[pos] == t) return static_cast<long long>(pos);
+            if (keys[pos] < t) low = pos + 1; else high = pos - 1;
+        }
+        return -1LL;
+    });
+    std::cout << "  " << static_cast<double>(probes) / queries << " probes/lookup" << std::endl;
+
+    time_queries("std::lower_bound    ", [&](int64_t t) {
+        return static_cast<long long>(std::lower_bound(keys.begin(), keys.end(), t) - keys.begin());
+    });
+
+    StaticSearchIndex<int64_t> eytzinger(keys);
+    time_queries("eytzinger           ", [&](int64_t t) { return static_cast<long long>(eytzinger.lower_bound(t)); });
+
+    for (size_t eps : {8, 32, 128}) {
+        LearnedIndexConfig config;
+        config.epsilon = eps;
+        LearnedIndex<int64_t> index(keys, config);
+        std::string name = "learned, epsilon " + std::to_string(eps);
+        name.resize(20, ' ');
+        time_queries(name.c_str(), [&](int64_t t) { return static_cast<long long>(index.lower_bound(t)); });
+        print_learned_index_stats(index, "  model");
+    }
+}